@@ -37,6 +37,27 @@ void CategoryTest::testUnits()
     QCOMPARE(cg.unit(Kilogram).symbol(), QStringLiteral("kg"));
     QVERIFY(cg.units().size() > 0);
     QVERIFY(cg.allUnits().size() > 0);
+
+    const QSpan<const Unit> units = cg.unitsView();
+    QCOMPARE(QList<Unit>(units.begin(), units.end()), cg.units());
+    const QSpan<const Unit> mostCommonUnits = cg.mostCommonUnitsView();
+    QCOMPARE(QList<Unit>(mostCommonUnits.begin(), mostCommonUnits.end()), cg.mostCommonUnits());
+    QVERIFY(UnitCategory().unitsView().isEmpty());
+}
+
+void CategoryTest::testNormalizedLookup()
+{
+    const UnitCategory length = c.category(LengthCategory);
+    QVERIFY(!length.unit(QStringLiteral("KM")).isValid());
+    QVERIFY(!length.unit(QStringLiteral("KM"), ExactMatch).isValid());
+    QCOMPARE(length.unit(QStringLiteral("KM"), NormalizedMatch).id(), Kilometer);
+    QCOMPARE(length.unit(QStringLiteral("Kilometers"), NormalizedMatch).id(), Kilometer);
+    QCOMPARE(length.unit(QStringLiteral("ångstroms"), NormalizedMatch).id(), Angstrom);
+    QCOMPARE(length.unit(QStringLiteral("ANGSTRÖM"), NormalizedMatch).id(), Angstrom);
+    // exact matches win over names differing in case
+    QCOMPARE(length.unit(QStringLiteral("Mm"), NormalizedMatch).id(), Megameter);
+    QCOMPARE(length.unit(QStringLiteral("mm"), NormalizedMatch).id(), Millimeter);
+    QVERIFY(!length.unit(QStringLiteral("kg"), NormalizedMatch).isValid());
 }
 
 void CategoryTest::testConvert()
@@ -50,6 +71,49 @@ void CategoryTest::testConvert()
     QCOMPARE(v.number(), 3140.0);
 }
 
+void CategoryTest::testConvertToAll_data()
+{
+    QTest::addColumn<int>("categoryId");
+    QTest::addColumn<int>("unitId");
+    QTest::addColumn<qreal>("number");
+
+    QTest::addRow("length") << int(LengthCategory) << int(Mile) << 26.2;
+    QTest::addRow("temperature") << int(TemperatureCategory) << int(Fahrenheit) << -40.5;
+    QTest::addRow("fuel efficiency") << int(FuelEfficiencyCategory) << int(LitersPer100Kilometers) << 6.5;
+    QTest::addRow("currency") << int(CurrencyCategory) << int(Eur) << 100.0;
+}
+
+void CategoryTest::testConvertToAll()
+{
+    QFETCH(int, categoryId);
+    QFETCH(int, unitId);
+    QFETCH(qreal, number);
+
+    const UnitCategory cg = c.category(CategoryId(categoryId));
+    const Value value(number, UnitId(unitId));
+    const QSpan<const Unit> units = cg.unitsView();
+    QList<qreal> numbers(units.size());
+    QVERIFY(cg.convertToAll(value, numbers));
+    for (qsizetype i = 0; i < units.size(); ++i) {
+        QCOMPARE(numbers[i], value.convertTo(units[i]).number());
+    }
+
+    const QSpan<const Unit> mostCommonUnits = cg.mostCommonUnitsView();
+    numbers.resize(mostCommonUnits.size());
+    QVERIFY(cg.convertToMostCommon(value, numbers));
+    for (qsizetype i = 0; i < mostCommonUnits.size(); ++i) {
+        QCOMPARE(numbers[i], value.convertTo(mostCommonUnits[i]).number());
+    }
+
+    // too small, of another category or invalid
+    numbers.resize(units.size() - 1);
+    QVERIFY(!cg.convertToAll(value, numbers));
+    numbers.resize(units.size());
+    QVERIFY(!cg.convertToAll(Value(1.0, Kilogram), numbers));
+    QVERIFY(!cg.convertToAll(Value(), numbers));
+    QVERIFY(!UnitCategory().convertToAll(value, numbers));
+}
+
 void CategoryTest::testInvalid()
 {
     UnitCategory cg = c.category(CategoryId(99999));
@@ -20,7 +20,10 @@ private Q_SLOTS:
     void initTestCase();
     void testInfo();
     void testUnits();
+    void testNormalizedLookup();
     void testConvert();
+    void testConvertToAll_data();
+    void testConvertToAll();
     void testInvalid();
     void testCurrencyTableUpdate();
 
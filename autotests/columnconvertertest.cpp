@@ -0,0 +1,120 @@
+/*
+ *   SPDX-FileCopyrightText: 2026 KUnitConversion Authors
+ *
+ *   SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#include "columnconvertertest.h"
+
+#include <QBuffer>
+#include <QStandardPaths>
+#include <kunitconversion/columnconverter.h>
+#include <kunitconversion/converter.h>
+
+using namespace KUnitConversion;
+
+static QByteArray convertColumn(ColumnConverter &converter, const QByteArray &input)
+{
+    QByteArray inputData = input;
+    QBuffer inputBuffer(&inputData);
+    inputBuffer.open(QIODevice::ReadOnly);
+    QByteArray outputData;
+    QBuffer outputBuffer(&outputData);
+    outputBuffer.open(QIODevice::WriteOnly);
+    if (!converter.convert(&inputBuffer, &outputBuffer)) {
+        return QByteArray();
+    }
+    return outputData;
+}
+
+void ColumnConverterTest::initTestCase()
+{
+    qputenv("KFUNITCONVERT_NO_DOWNLOAD", "1");
+    QStandardPaths::setTestModeEnabled(true);
+}
+
+void ColumnConverterTest::testConvert_data()
+{
+    QTest::addColumn<int>("column");
+    QTest::addColumn<char>("delimiter");
+    QTest::addColumn<int>("headerLines");
+    QTest::addColumn<int>("precision");
+    QTest::addColumn<QByteArray>("input");
+    QTest::addColumn<QByteArray>("output");
+    QTest::addColumn<qint64>("skipped");
+
+    QTest::newRow("csv") << 1 << ',' << 1 << -1 << QByteArray("name,distance\na,1.5\nb,2e-1\n") << QByteArray("name,distance\na,1500\nb,200\n")
+                         << qint64(0);
+    QTest::newRow("tsv") << 0 << '\t' << 0 << -1 << QByteArray("1\tx\n0.25\ty\n") << QByteArray("1000\tx\n250\ty\n") << qint64(0);
+    QTest::newRow("crlf and blanks") << 1 << ',' << 0 << -1 << QByteArray("a, 1 \r\nb,+2\r\n") << QByteArray("a, 1000 \r\nb,2000\r\n") << qint64(0);
+    QTest::newRow("quoted fields") << 1 << ',' << 0 << -1 << QByteArray("\"a,\"\"b\",3\n\"c\",\"4\"\n") << QByteArray("\"a,\"\"b\",3000\n\"c\",\"4\"\n")
+                                   << qint64(1);
+    QTest::newRow("no number") << 1 << ',' << 0 << -1 << QByteArray("a,abc\nb\nc,\nd,5x\n") << QByteArray("a,abc\nb\nc,\nd,5x\n") << qint64(4);
+    QTest::newRow("no final line break") << 0 << ',' << 0 << -1 << QByteArray("1\n2") << QByteArray("1000\n2000") << qint64(0);
+    QTest::newRow("precision") << 0 << ',' << 0 << 2 << QByteArray("0.0012345\n") << QByteArray("1.23\n") << qint64(0);
+}
+
+void ColumnConverterTest::testConvert()
+{
+    QFETCH(int, column);
+    QFETCH(char, delimiter);
+    QFETCH(int, headerLines);
+    QFETCH(int, precision);
+    QFETCH(QByteArray, input);
+    QFETCH(QByteArray, output);
+    QFETCH(qint64, skipped);
+
+    Converter c;
+    ColumnConverter converter(c.conversionPlan(Kilometer, Meter), column);
+    converter.setDelimiter(delimiter);
+    converter.setHeaderLineCount(headerLines);
+    converter.setPrecision(precision);
+    QCOMPARE(convertColumn(converter, input), output);
+    QCOMPARE(converter.skippedCount(), skipped);
+}
+
+void ColumnConverterTest::testLargeInput()
+{
+    // spans many chunks, so lines are split between reads
+    Converter c;
+    const ConversionPlan plan = c.conversionPlan(Mile, Kilometer);
+    const int lineCount = 100000;
+    QByteArray input;
+    QByteArray expected;
+    for (int i = 0; i < lineCount; ++i) {
+        const qreal miles = i * 0.37;
+        input += "row" + QByteArray::number(i) + ';' + QByteArray::number(miles, 'g', 17) + ";end\n";
+        expected += "row" + QByteArray::number(i) + ';' + QByteArray::number(plan.convert(QByteArray::number(miles, 'g', 17).toDouble()), 'g', 17) + ";end\n";
+    }
+
+    ColumnConverter converter(plan, 1);
+    converter.setDelimiter(';');
+    const QList<QByteArray> lines = convertColumn(converter, input).split('\n');
+    const QList<QByteArray> expectedLines = expected.split('\n');
+    QCOMPARE(lines.size(), expectedLines.size());
+    QCOMPARE(converter.convertedCount(), qint64(lineCount));
+    for (int i = 0; i < lineCount; ++i) {
+        const QList<QByteArray> fields = lines.at(i).split(';');
+        const QList<QByteArray> expectedFields = expectedLines.at(i).split(';');
+        QCOMPARE(fields.size(), 3);
+        QCOMPARE(fields.at(0), expectedFields.at(0));
+        // shortest round-trip output reads back to the same number
+        QCOMPARE(fields.at(1).toDouble(), expectedFields.at(1).toDouble());
+        QCOMPARE(fields.at(2), expectedFields.at(2));
+    }
+}
+
+void ColumnConverterTest::testInvalid()
+{
+    Converter c;
+    ColumnConverter converter(c.conversionPlan(Meter, Kilogram), 0);
+    QVERIFY(convertColumn(converter, "1\n").isNull());
+    QCOMPARE(converter.convertedCount(), qint64(0));
+
+    ColumnConverter valid(c.conversionPlan(Meter, Centimeter), 0);
+    QVERIFY(!valid.convert(nullptr, nullptr));
+}
+
+QTEST_MAIN(ColumnConverterTest)
+
+#include "moc_columnconvertertest.cpp"
@@ -0,0 +1,24 @@
+/*
+ *   SPDX-FileCopyrightText: 2026 KUnitConversion Authors
+ *
+ *   SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#ifndef COLUMNCONVERTERTEST_H
+#define COLUMNCONVERTERTEST_H
+
+#include <QObject>
+#include <QTest>
+
+class ColumnConverterTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void initTestCase();
+    void testConvert_data();
+    void testConvert();
+    void testLargeInput();
+    void testInvalid();
+};
+
+#endif // COLUMNCONVERTERTEST_H
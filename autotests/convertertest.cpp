@@ -6,11 +6,17 @@
 
 #include "convertertest.h"
 #include <QList>
+#include <QSet>
 #include <QSignalSpy>
 #include <QStandardPaths>
 #include <QThread>
+#include <limits>
+#include <converter_p.h>
 #include <currency_p.h>
+#include <unitcategory_p.h>
+#include <unittrie_p.h>
 #include <kunitconversion/unitcategory.h>
+#include <kunitconversion/unittable.h>
 
 using namespace KUnitConversion;
 using namespace std::chrono_literals;
@@ -24,6 +30,70 @@ void ConverterTest::initTestCase()
     QFile::remove(cache);
 }
 
+static const std::pair<const char *, UnitId> lookupUnits[] = {
+    {"km", Kilometer},
+    {"kg", Kilogram},
+    {"mpg", MilePerUsGallon},
+    {"N", Newton},
+    {"Hz", Hertz},
+    {"GiB", Gibibyte},
+};
+
+class LookupTestThread : public QThread
+{
+public:
+    LookupTestThread(int first)
+        : m_first(first)
+    {
+    }
+    void run() override
+    {
+        // categories are built on first use, every thread starts with another one
+        Converter c;
+        const int count = std::size(lookupUnits);
+        for (int i = 0; i < count; ++i) {
+            const auto &[name, unitId] = lookupUnits[(m_first + i) % count];
+            const Unit unit = c.unit(QString::fromUtf8(name));
+            if (unit.id() == unitId && c.unit(unitId) == unit && c.categoryForUnitId(unitId) == unit.category()) {
+                ++matches;
+            }
+        }
+    }
+    int m_first;
+    int matches = 0;
+};
+
+void ConverterTest::testConcurrentLookup()
+{
+    // must run before anything else uses the converter
+    const int numThreads = 8;
+    QList<LookupTestThread *> threads;
+    for (int i = 0; i < numThreads; ++i) {
+        threads.append(new LookupTestThread(i));
+    }
+    for (LookupTestThread *thread : std::as_const(threads)) {
+        thread->start();
+    }
+    for (LookupTestThread *thread : std::as_const(threads)) {
+        thread->wait();
+        QCOMPARE(thread->matches, int(std::size(lookupUnits)));
+    }
+    qDeleteAll(threads);
+}
+
+void ConverterTest::testGlobal()
+{
+    const Converter &global = Converter::global();
+    QCOMPARE(&global, &Converter::global());
+    QCOMPARE(global.unit(Meter), Converter().unit(Meter));
+    QCOMPARE(global.convert(Value(1.5, Kilometer), Meter).number(), 1500.0);
+    QCOMPARE(global.convert(Value(1.5, Kilometer), QString()).unit().id(), Meter);
+    QCOMPARE(global.convert(Value(1.5, Kilometer), QStringLiteral("cm")).number(), 150000.0);
+    QVERIFY(!global.convert(Value(1.5, Kilometer), Kilogram).isValid());
+    QVERIFY(!global.convert(Value(1.5, Kilometer), QStringLiteral("kg")).isValid());
+    QVERIFY(!global.convert(Value(), Meter).isValid());
+}
+
 void ConverterTest::testCategory()
 {
     Converter c;
@@ -31,6 +101,13 @@ void ConverterTest::testCategory()
     QCOMPARE(c.category(QStringLiteral("Length")).id(), LengthCategory);
     QCOMPARE(c.category(LengthCategory).name(), QStringLiteral("Length"));
     QVERIFY(c.categories().size() > 0);
+
+    const QSpan<const UnitCategory> categories = c.categoriesView();
+    QCOMPARE(QList<UnitCategory>(categories.begin(), categories.end()), c.categories());
+    for (qsizetype i = 0; i < categories.size(); ++i) {
+        QCOMPARE(categories[i].id(), CategoryId(i));
+    }
+    QCOMPARE(c.categoriesView().data(), categories.data());
 }
 
 void ConverterTest::testUnits()
@@ -38,6 +115,161 @@ void ConverterTest::testUnits()
     Converter c;
     QCOMPARE(c.unit(QStringLiteral("km")).symbol(), QStringLiteral("km"));
     QCOMPARE(c.unit(Kilogram).symbol(), QStringLiteral("kg"));
+    QCOMPARE(c.categoryForUnitId(Kilogram).id(), MassCategory);
+    QCOMPARE(c.categoryForUnitId(Bit).id(), BinaryDataCategory);
+
+    QVERIFY(!c.unit(QStringLiteral("KILOGRAMS")).isValid());
+    QCOMPARE(c.unit(QStringLiteral("KILOGRAMS"), NormalizedMatch).id(), Kilogram);
+    QCOMPARE(c.unit(QStringLiteral("Ångström"), NormalizedMatch).id(), Angstrom);
+    QCOMPARE(c.unit(QStringLiteral("ångström"), NormalizedMatch).id(), Angstrom);
+    QCOMPARE(c.unit(QStringLiteral("Mph"), NormalizedMatch).id(), MilePerHour);
+    QVERIFY(c.unit(QStringLiteral("does not exist"), NormalizedMatch).isNull());
+
+    QList<Unit> units;
+    for (const UnitCategory &category : c.categoriesView()) {
+        units.append(category.units());
+    }
+    const QSpan<const Unit> allUnits = c.allUnitsView();
+    QCOMPARE(QList<Unit>(allUnits.begin(), allUnits.end()), units);
+    QCOMPARE(c.allUnitsView().data(), allUnits.data());
+}
+
+void ConverterTest::testUnitIndex()
+{
+    Converter c;
+    const auto categories = c.categories();
+    for (const UnitCategory &category : categories) {
+        const auto names = category.allUnits();
+        for (const QString &name : names) {
+            const Unit unit = c.unit(name);
+            QVERIFY(unit.isValid());
+            // synonyms shared between categories resolve to the first category
+            QVERIFY(unit.categoryId() <= category.id());
+            QCOMPARE(c.categoryForUnit(name), unit.category());
+        }
+        const auto units = category.units();
+        for (const Unit &unit : units) {
+            QCOMPARE(c.unit(unit.id()), unit);
+            QCOMPARE(c.categoryForUnitId(unit.id()), category);
+        }
+    }
+}
+
+void ConverterTest::testUnitNameCache()
+{
+    // an unknown name builds all categories once, which writes the name cache
+    QVERIFY(!Converter().unit(QStringLiteral("no such unit")).isValid());
+
+    // like another process reading the cache
+    ConverterPrivate d;
+    const Unit *unit = d.unit(QStringLiteral("mebibyte"));
+    QVERIFY(unit);
+    QCOMPARE(unit->id(), Mebibyte);
+    QVERIFY(d.isBuilt(BinaryDataCategory));
+    QVERIFY(!d.isBuilt(LengthCategory));
+
+    unit = d.unit(QStringLiteral("Mebibytes"), NormalizedMatch);
+    QVERIFY(unit);
+    QCOMPARE(unit->id(), Mebibyte);
+
+    QVERIFY(!d.unit(QStringLiteral("no such unit")));
+    QVERIFY(!d.unit(QStringLiteral("no such unit"), NormalizedMatch));
+    for (int id = 0; id < ConverterPrivate::CategoryCount; ++id) {
+        QCOMPARE(d.isBuilt(CategoryId(id)), id == BinaryDataCategory);
+    }
+}
+
+void ConverterTest::testUnitTrie()
+{
+    Converter c;
+    const QList<std::pair<QString, Unit>> units = {
+        {QStringLiteral("km"), c.unit(Kilometer)},
+        {QStringLiteral("kilometer"), c.unit(Kilometer)},
+        {QStringLiteral("Km"), c.unit(Kelvin)},
+        {QStringLiteral("m"), c.unit(Meter)},
+        {QStringLiteral("meter"), c.unit(Meter)},
+        {QStringLiteral("mile"), c.unit(Mile)},
+        {QStringLiteral("km"), c.unit(Kilogram)},
+    };
+    const UnitTrie trie(units);
+    QCOMPARE(trie.size(), qsizetype(6));
+
+    QCOMPARE(trie.unit(u"km")->id(), Kilometer);
+    QCOMPARE(trie.unit(u"Km")->id(), Kelvin);
+    QVERIFY(!trie.unit(u"KM"));
+    QVERIFY(!trie.unit(u"kilo"));
+    QVERIFY(!trie.unit(u"kilometers"));
+
+    QCOMPARE(trie.unitIgnoringCase(u"KM")->id(), Kilometer);
+    QCOMPARE(trie.unitIgnoringCase(u"Km")->id(), Kelvin);
+    QCOMPARE(trie.unitIgnoringCase(u"MILE")->id(), Mile);
+    QVERIFY(!trie.unitIgnoringCase(u"mil"));
+
+    QCOMPARE(trie.namesStartingWith(u"m", Qt::CaseInsensitive), QStringList({QStringLiteral("m"), QStringLiteral("meter"), QStringLiteral("mile")}));
+    QCOMPARE(trie.namesStartingWith(u"K", Qt::CaseInsensitive), QStringList({QStringLiteral("kilometer"), QStringLiteral("km"), QStringLiteral("Km")}));
+    QCOMPARE(trie.namesStartingWith(u"K", Qt::CaseSensitive), QStringList({QStringLiteral("Km")}));
+    QCOMPARE(trie.namesStartingWith(u"me", Qt::CaseInsensitive, 1), QStringList({QStringLiteral("meter")}));
+    QCOMPARE(trie.namesStartingWith(u"x", Qt::CaseInsensitive), QStringList());
+    QCOMPARE(trie.namesStartingWith(u"", Qt::CaseInsensitive).size(), qsizetype(6));
+
+    QCOMPARE(trie.similarNames(u"MLE", -1, 2), QStringList({QStringLiteral("mile"), QStringLiteral("m")}));
+    QCOMPARE(trie.similarNames(u"mle", -1, 1), QStringList({QStringLiteral("mile")}));
+    QCOMPARE(trie.similarNames(u"mle", 1, 2), QStringList({QStringLiteral("mile")}));
+    QCOMPARE(trie.similarNames(u"kilometre", -1, 2), QStringList({QStringLiteral("kilometer")}));
+    QCOMPARE(trie.similarNames(u"k", -1, 1), QStringList({QStringLiteral("km"), QStringLiteral("Km"), QStringLiteral("m")}));
+    QVERIFY(trie.similarNames(u"xyzzyq", -1, 2).isEmpty());
+}
+
+void ConverterTest::testUnitNamesStartingWith()
+{
+    Converter c;
+    QSet<QString> allNames;
+    const auto categories = c.categories();
+    for (const UnitCategory &category : categories) {
+        const auto names = category.allUnits();
+        for (const QString &name : names) {
+            allNames.insert(name);
+        }
+    }
+
+    for (const QString &prefix : {QStringLiteral("k"), QStringLiteral("Kilo"), QStringLiteral("mile"), QStringLiteral("°"), QString()}) {
+        const QStringList names = c.unitNamesStartingWith(prefix);
+        QSet<QString> expected;
+        for (const QString &name : std::as_const(allNames)) {
+            if (name.startsWith(prefix, Qt::CaseInsensitive)) {
+                expected.insert(name);
+            }
+        }
+        QCOMPARE(QSet<QString>(names.begin(), names.end()), expected);
+        QCOMPARE(names.size(), expected.size());
+
+        for (const QString &name : names) {
+            QVERIFY(c.unit(name).isValid());
+        }
+        const QStringList caseSensitive = c.unitNamesStartingWith(prefix, Qt::CaseSensitive);
+        for (const QString &name : caseSensitive) {
+            QVERIFY(name.startsWith(prefix));
+        }
+    }
+    QCOMPARE(c.unitNamesStartingWith(u"kilo", Qt::CaseInsensitive, 3).size(), qsizetype(3));
+    QVERIFY(c.unitNamesStartingWith(u"does not exist").isEmpty());
+}
+
+void ConverterTest::testSimilarUnitNames()
+{
+    Converter c;
+    QCOMPARE(c.similarUnitNames(u"kilomter").value(0), QStringLiteral("kilometer"));
+    QCOMPARE(c.similarUnitNames(u"KILOGRAMS", 1), QStringList({QStringLiteral("kilograms")}));
+    QVERIFY(c.similarUnitNames(u"fahrenheit", 10, 0).contains(QStringLiteral("Fahrenheit")));
+    QVERIFY(c.similarUnitNames(u"kilomter", 3).size() <= 3);
+    QVERIFY(c.similarUnitNames(u"qqqqqqqqqqqq").isEmpty());
+
+    // every suggestion is a known name within the distance
+    const QStringList names = c.similarUnitNames(u"metr", -1, 2);
+    QVERIFY(names.contains(QStringLiteral("meter")));
+    for (const QString &name : names) {
+        QVERIFY(c.unit(name).isValid());
+    }
 }
 
 void ConverterTest::testConvert()
@@ -71,12 +303,261 @@ void ConverterTest::testConvert()
     QCOMPARE(v.number(), 33.0);
 }
 
+void ConverterTest::testConvertBatch()
+{
+    Converter c;
+    const QList<qreal> kilometers = {3.14, 1.0, 0.0, -2.5};
+    QList<qreal> meters(kilometers.size());
+    QVERIFY(c.convert(kilometers, Kilometer, Meter, meters));
+    for (qsizetype i = 0; i < kilometers.size(); ++i) {
+        QCOMPARE(meters[i], c.convert(Value(kilometers[i], Kilometer), Meter).number());
+    }
+
+    QList<qreal> temperatures = {-40.0, 0.0, 100.0};
+    QVERIFY(c.convert(temperatures, Celsius, Fahrenheit));
+    QCOMPARE(temperatures[0], -40.0);
+    QCOMPARE(temperatures[1], 32.0);
+    QCOMPARE(temperatures[2], 212.0);
+
+    QList<qreal> fuel = {8.0};
+    QVERIFY(c.convert(fuel, LitersPer100Kilometers, MilePerUsGallon));
+    QCOMPARE(fuel[0], 29.401875);
+
+    QVERIFY(!c.convert(meters, Meter, Kilogram));
+    QVERIFY(!c.convert(meters, Meter, UnitId(99999)));
+    QList<qreal> tooSmall(1);
+    QVERIFY(!c.convert(kilometers, Kilometer, Meter, tooSmall));
+}
+
+void ConverterTest::testConvertMixedUnits()
+{
+    Converter c;
+    const QList<qreal> masses = {1.5, 2.0, 12.0, 0.25, -3.0};
+    const QList<UnitId> massUnits = {Kilogram, Pound, Ounce, Ton, Gram};
+    QList<qreal> kilograms(masses.size());
+    QVERIFY(c.convert(masses, massUnits, Kilogram, kilograms));
+    for (qsizetype i = 0; i < masses.size(); ++i) {
+        QCOMPARE(kilograms[i], Value(masses[i], massUnits[i]).convertTo(Kilogram).number());
+    }
+
+    // units that are not a multiple of the target, in place
+    QList<qreal> temperatures = {-40.0, 273.15, 212.0, 20.0};
+    const QList<UnitId> temperatureUnits = {Celsius, Kelvin, Fahrenheit, Celsius};
+    QVERIFY(c.convert(temperatures, temperatureUnits, Celsius, temperatures));
+    QCOMPARE(temperatures[0], -40.0);
+    QCOMPARE(temperatures[1], 0.0);
+    QCOMPARE(temperatures[2], 100.0);
+    QCOMPARE(temperatures[3], 20.0);
+
+    // units of other categories or no unit at all
+    const QList<UnitId> wrongUnits = {Meter, UnitId(99999), InvalidUnit, Pound, Kilogram};
+    QVERIFY(c.convert(masses, wrongUnits, Kilogram, kilograms));
+    QVERIFY(qIsNaN(kilograms[0]));
+    QVERIFY(qIsNaN(kilograms[1]));
+    QVERIFY(qIsNaN(kilograms[2]));
+    QCOMPARE(kilograms[3], Value(masses[3], Pound).convertTo(Kilogram).number());
+    QCOMPARE(kilograms[4], masses[4]);
+
+    QVERIFY(!c.convert(masses, massUnits, UnitId(99999), kilograms));
+    QVERIFY(!c.convert(masses, massUnits.first(2), Kilogram, kilograms));
+    QList<qreal> tooSmall(1);
+    QVERIFY(!c.convert(masses, massUnits, Kilogram, tooSmall));
+}
+
+void ConverterTest::testToBestUnits()
+{
+    Converter c;
+    const QList<qreal> meters = {0.5, 1500.0, 0.0, -2e6, 999.0, qQNaN()};
+    QList<qreal> numbers(meters.size());
+    QList<UnitId> units(meters.size());
+    QVERIFY(c.toBestUnits(meters, Meter, numbers, units));
+    QCOMPARE(units, QList<UnitId>({Millimeter, Kilometer, Meter, Megameter, Meter, Meter}));
+    for (qsizetype i = 0; i < meters.size() - 1; ++i) {
+        QCOMPARE(numbers[i], Value(meters[i], Meter).toBestUnit().number());
+    }
+    QVERIFY(qIsNaN(numbers.last()));
+
+    // in place, and units without a ladder stay as they are
+    QList<qreal> miles = {0.001, 1e6};
+    QVERIFY(c.toBestUnits(miles, Mile, miles, units));
+    QCOMPARE(miles, QList<qreal>({0.001, 1e6}));
+    QCOMPARE(units.first(2), QList<UnitId>({Mile, Mile}));
+
+    QVERIFY(!c.toBestUnits(meters, UnitId(99999), numbers, units));
+    QList<UnitId> tooSmall(1);
+    QVERIFY(!c.toBestUnits(meters, Meter, numbers, tooSmall));
+}
+
+static qreal finiteMagnitude(qreal number)
+{
+    return qIsFinite(number) ? qAbs(number) : 0.0;
+}
+
+void ConverterTest::testConversionPlan()
+{
+    Converter c;
+    const auto categories = c.categories();
+    for (const UnitCategory &category : categories) {
+        if (category.hasOnlineConversionTable()) {
+            continue;
+        }
+        const auto units = category.units();
+        for (const Unit &from : units) {
+            for (const Unit &to : units) {
+                const ConversionPlan plan(from, to);
+                QVERIFY(plan.isValid());
+                // the folded conversion may only differ from the one through the default unit
+                // by the bound ConversionPlan documents
+                const qreal zeroPoints = finiteMagnitude(Value(0.0, from).convertTo(to).number())
+                    + finiteMagnitude(Value(0.0, category.defaultUnit()).convertTo(to).number());
+                for (const qreal number : {-1000.0, -40.0, -1.5, 0.1, 1.5, 42.0, 1000.0, 1e6}) {
+                    const qreal converted = plan.convert(number);
+                    const qreal expected = Value(number, from).convertTo(to).number();
+                    const qreal bound = 4 * std::numeric_limits<qreal>::epsilon() * (finiteMagnitude(expected) + zeroPoints);
+                    QVERIFY2(converted == expected || (qIsNaN(converted) && qIsNaN(expected)) || qAbs(converted - expected) <= bound,
+                             qPrintable(QStringLiteral("%1 %2 -> %3: %4 instead of %5")
+                                            .arg(number)
+                                            .arg(from.symbol(), to.symbol())
+                                            .arg(converted, 0, 'g', 17)
+                                            .arg(expected, 0, 'g', 17)));
+                }
+            }
+        }
+    }
+
+    const ConversionPlan plan = c.conversionPlan(Celsius, Fahrenheit);
+    QList<qreal> temperatures = {-40.0, 100.0};
+    QVERIFY(plan.convert(temperatures));
+    QCOMPARE(temperatures[0], -40.0);
+    QCOMPARE(temperatures[1], 212.0);
+
+    QVERIFY(!c.conversionPlan(Meter, Kilogram).isValid());
+    QVERIFY(!ConversionPlan().isValid());
+    QVERIFY(qIsNaN(ConversionPlan().convert(1.0)));
+}
+
+void ConverterTest::testFactorMatrix()
+{
+    Converter c;
+    for (const CategoryId categoryId : {TemperatureCategory, FuelEfficiencyCategory, PowerCategory, VelocityCategory}) {
+        QVERIFY(!UnitCategoryPrivate::get(c.category(categoryId))->factorMatrix());
+    }
+
+    const UnitCategory length = c.category(LengthCategory);
+    const FactorMatrix *matrix = UnitCategoryPrivate::get(length)->factorMatrix();
+    QVERIFY(matrix);
+    QCOMPARE(matrix, UnitCategoryPrivate::get(length)->factorMatrix());
+    QCOMPARE(matrix->size, length.unitsView().size());
+
+    const auto categories = c.categories();
+    for (const UnitCategory &category : categories) {
+        matrix = UnitCategoryPrivate::get(category)->factorMatrix();
+        if (!matrix || category.hasOnlineConversionTable()) {
+            continue;
+        }
+        const QSpan<const Unit> units = category.unitsView();
+        for (qsizetype from = 0; from < units.size(); ++from) {
+            const qreal fromScale = unitDefinition(units[from].id())->scale;
+            for (qsizetype to = 0; to < units.size(); ++to) {
+                const qreal toScale = unitDefinition(units[to].id())->scale;
+                const qreal factor = matrix->factor(from, to);
+                QCOMPARE(factor, qreal(static_cast<long double>(fromScale) / toScale));
+                // plans multiply by the factor once
+                QVERIFY(ConversionPlan(units[from], units[to]).convert(3.7) == factor * 3.7);
+                // values still convert to the default unit and from there as they always did, bit for bit
+                for (const qreal number : {3.7, -0.1, 1e-5, 12345.678}) {
+                    QVERIFY2(Value(number, units[from]).convertTo(units[to]).number() == number * fromScale / toScale,
+                             qPrintable(units[from].symbol() + QLatin1String(" -> ") + units[to].symbol()));
+                }
+            }
+        }
+    }
+    QVERIFY(Value(1.0, Mile).convertTo(Kilometer).number() == 1.60934);
+}
+
+namespace
+{
+// Unit with its conversions to and from the default unit accessible
+class DefaultConvertingUnit : public Unit
+{
+public:
+    explicit DefaultConvertingUnit(const Unit &unit)
+        : Unit(unit)
+    {
+    }
+
+    using Unit::fromDefault;
+    using Unit::toDefault;
+};
+}
+
+void ConverterTest::testUnitTable()
+{
+    Converter c;
+    static_assert(convert<Kilometer, Meter>(1.5) == 1500.0);
+    static_assert(convert<Kibibyte, Byte>(2.0) == 2048.0);
+    // template arguments need parentheses inside the test macros
+    QCOMPARE((convert<Celsius, Fahrenheit>(100.0)), 212.0);
+    QCOMPARE((convert<Mile, Kilometer>(2.0)), c.conversionPlan(Mile, Kilometer).convert(2.0));
+    QCOMPARE((convert<MilePerUsGallon, LitersPer100Kilometers>(30.0)), Value(30.0, MilePerUsGallon).convertTo(LitersPer100Kilometers).number());
+    QCOMPARE((convert<MilePerUsGallon, KilometrePerLitre>(30.0)), Value(30.0, MilePerUsGallon).convertTo(KilometrePerLitre).number());
+
+    static_assert(std::adjacent_find(std::begin(unitDefinitions),
+                                     std::end(unitDefinitions),
+                                     [](const UnitDefinition &lhs, const UnitDefinition &rhs) {
+                                         return lhs.id >= rhs.id;
+                                     })
+                      == std::end(unitDefinitions),
+                  "unitDefinitions must be sorted by id without duplicates");
+
+    // every unit but currencies is built from its definition and must convert as it
+    // says, with the folded transform as well as with its own toDefault() and fromDefault()
+    const auto categories = c.categories();
+    for (const UnitCategory &category : categories) {
+        const auto units = category.units();
+        for (const Unit &unit : units) {
+            const UnitDefinition *definition = unitDefinition(unit.id());
+            if (category.hasOnlineConversionTable()) {
+                QVERIFY(!definition);
+                continue;
+            }
+            QVERIFY2(definition, qPrintable(unit.symbol()));
+            QCOMPARE(definition->id, unit.id());
+            QCOMPARE(definition->categoryId, category.id());
+            const ConversionPlan plan(unit, category.defaultUnit());
+            for (const qreal number : {1.5, 42.0}) {
+                qreal expected;
+                switch (definition->kind) {
+                case UnitDefinition::Linear:
+                    expected = definition->scale * number + definition->offset;
+                    break;
+                case UnitDefinition::Reciprocal:
+                    expected = definition->scale / number;
+                    break;
+                case UnitDefinition::Other:
+                    continue;
+                }
+                QCOMPARE(plan.convert(number), expected);
+                const DefaultConvertingUnit defaultConverting(unit);
+                QCOMPARE(defaultConverting.toDefault(number), expected);
+                QCOMPARE(defaultConverting.fromDefault(expected), number);
+            }
+        }
+    }
+    QCOMPARE(c.unit(Momme).categoryId(), WeightPerAreaCategory);
+    QVERIFY(!unitDefinition(Eur));
+    QVERIFY(!unitDefinition(InvalidUnit));
+}
+
 void ConverterTest::testInvalid()
 {
     Converter c;
     QCOMPARE(c.categoryForUnit(QStringLiteral("does not exist")).id(), InvalidCategory);
     QCOMPARE(c.unit(QStringLiteral("does not exist")).symbol(), QString());
     QCOMPARE(c.category(QStringLiteral("does not exist")).name(), QString());
+    QVERIFY(c.unit(InvalidUnit).isNull());
+    QVERIFY(c.unit(UnitId(99999)).isNull());
+    QCOMPARE(c.categoryForUnitId(UnitId(1999)).id(), InvalidCategory);
 }
 
 class CurrencyTestThread : public QThread
@@ -18,9 +18,22 @@ class ConverterTest : public QObject
     Q_OBJECT
 private Q_SLOTS:
     void initTestCase();
+    void testConcurrentLookup();
+    void testGlobal();
     void testCategory();
     void testUnits();
+    void testUnitIndex();
+    void testUnitNameCache();
+    void testUnitTrie();
+    void testUnitNamesStartingWith();
+    void testSimilarUnitNames();
     void testConvert();
+    void testConvertBatch();
+    void testConvertMixedUnits();
+    void testToBestUnits();
+    void testConversionPlan();
+    void testFactorMatrix();
+    void testUnitTable();
     void testInvalid();
     void testCurrency();
 };
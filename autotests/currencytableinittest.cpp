@@ -6,7 +6,9 @@
 
 #include "currencytableinittest.h"
 #include <QStandardPaths>
+#include <QThread>
 #include <cmath>
+#include <currency_p.h>
 
 using namespace KUnitConversion;
 
@@ -30,6 +32,87 @@ void CurrencyTableInitTest::testCategoryInit()
     QVERIFY(!std::isnan(v.number()));
 }
 
+void CurrencyTableInitTest::testRateCache()
+{
+    const QString cache = QStandardPaths::writableLocation(QStandardPaths::GenericDataLocation) + QStringLiteral("/libkunitconversion/currency.xml");
+    const QString rateCache = cache + QStringLiteral(".rates");
+
+    // written when the table was read in testCategoryInit
+    QVERIFY(QFile::exists(rateCache));
+    QVERIFY(Currency::readRateCache(cache));
+    Converter c;
+    const qreal expected = c.convert(Value(1000, Eur), Usd).number();
+    QVERIFY(!std::isnan(expected));
+
+    QFile file(rateCache);
+    QVERIFY(file.open(QIODevice::ReadWrite));
+    const QByteArray data = file.readAll();
+    QByteArray corrupted = data;
+    corrupted[corrupted.size() - 1] = char(~corrupted.at(corrupted.size() - 1));
+    QVERIFY(file.seek(0));
+    QCOMPARE(file.write(corrupted), corrupted.size());
+    file.close();
+    QVERIFY(!Currency::readRateCache(cache));
+
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    QCOMPARE(file.write(data), data.size());
+    file.close();
+    QVERIFY(Currency::readRateCache(cache));
+
+    // a newer table makes the cache outdated
+    QFile table(cache);
+    QVERIFY(table.open(QIODevice::ReadWrite));
+    QVERIFY(table.setFileTime(QDateTime::currentDateTime().addSecs(60), QFileDevice::FileModificationTime));
+    table.close();
+    QVERIFY(!Currency::readRateCache(cache));
+    QCOMPARE(c.convert(Value(1000, Eur), Usd).number(), expected);
+}
+
+class ConversionTestThread : public QThread
+{
+public:
+    ConversionTestThread(qreal expected)
+        : m_expected(expected)
+    {
+    }
+    void run() override
+    {
+        Converter c;
+        for (int i = 0; i < 1000; ++i) {
+            if (c.convert(Value(1000, Eur), Usd).number() != m_expected) {
+                ++mismatches;
+            }
+        }
+    }
+    qreal m_expected;
+    int mismatches = 0;
+};
+
+void CurrencyTableInitTest::testConcurrentUpdate()
+{
+    Converter c;
+    const qreal expected = c.convert(Value(1000, Eur), Usd).number();
+    QVERIFY(!std::isnan(expected));
+
+    const int numThreads = 4;
+    QList<ConversionTestThread *> threads;
+    for (int i = 0; i < numThreads; ++i) {
+        threads.append(new ConversionTestThread(expected));
+    }
+    for (ConversionTestThread *thread : std::as_const(threads)) {
+        thread->start();
+    }
+    // reading the same table again publishes equal rates
+    for (int i = 0; i < 20; ++i) {
+        QVERIFY(Currency::readConversionTable(QStringLiteral(":/currency.xml")));
+    }
+    for (ConversionTestThread *thread : std::as_const(threads)) {
+        thread->wait();
+        QCOMPARE(thread->mismatches, 0);
+    }
+    qDeleteAll(threads);
+}
+
 QTEST_MAIN(CurrencyTableInitTest)
 
 #include "moc_currencytableinittest.cpp"
@@ -21,6 +21,14 @@ private Q_SLOTS:
      * Check that the currency converter is correctly initialized when currency.xml is recent and available
      */
     void testCategoryInit();
+    /**
+     * Check that the binary rate cache is written and only used when it matches the table
+     */
+    void testRateCache();
+    /**
+     * Check that conversions on other threads see either the old or the new rates while the table is replaced
+     */
+    void testConcurrentUpdate();
 };
 
 #endif
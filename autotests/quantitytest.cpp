@@ -0,0 +1,128 @@
+/*
+ *   SPDX-FileCopyrightText: 2026 KUnitConversion Authors
+ *
+ *   SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#include "quantitytest.h"
+
+#include <QStandardPaths>
+#include <kunitconversion/quantity.h>
+#include <kunitconversion/value.h>
+
+using namespace KUnitConversion;
+
+static_assert(std::is_trivially_copyable_v<Quantity>);
+static_assert(Quantity(3.0, Meter).number() == 3.0);
+static_assert(Quantity(3.0, Meter) != Quantity(3.0, Kilometer));
+
+void QuantityTest::initTestCase()
+{
+    qputenv("KFUNITCONVERT_NO_DOWNLOAD", "1");
+    QStandardPaths::setTestModeEnabled(true);
+    QLocale::setDefault(QLocale::c());
+}
+
+void QuantityTest::testStrings()
+{
+    const Quantity q(6.1415, Meter);
+    QCOMPARE(q.unit().symbol(), QStringLiteral("m"));
+    QCOMPARE(q.toSymbolString(), QStringLiteral("6.1415 m"));
+    QCOMPARE(Quantity(9.1415, Kilometer).toString(), QStringLiteral("9.1415 kilometers"));
+    QCOMPARE(q.toSymbolString(0, 'f', 1), Value(6.1415, Meter).toSymbolString(0, 'f', 1));
+}
+
+void QuantityTest::testConvert()
+{
+    Quantity q(3.14, Kilometer);
+    q = q.convertTo(Meter);
+    QCOMPARE(q.unitId(), Meter);
+    QCOMPARE(q.number(), 3140.0);
+    q = q.convertTo(Centimeter);
+    QCOMPARE(q.number(), 314000.0);
+
+    QCOMPARE(Quantity(100.0, Celsius).convertTo(Fahrenheit).number(), 212.0);
+    QCOMPARE(Quantity(8.0, LitersPer100Kilometers).convertTo(MilePerUsGallon).number(), 29.401875);
+    QCOMPARE(Quantity(10800, Joule).convertTo(WattHour).number(), 3.0);
+}
+
+void QuantityTest::testCompare()
+{
+    QCOMPARE(Quantity(1.0, Kilometer).compare(Quantity(1000.0, Meter)), Qt::partial_ordering::equivalent);
+    QCOMPARE(Quantity(1.0, Kilometer).compare(Quantity(999.0, Meter)), Qt::partial_ordering::greater);
+    QCOMPARE(Quantity(0.0, Celsius).compare(Quantity(0.0, Fahrenheit)), Qt::partial_ordering::greater);
+    QCOMPARE(Quantity(1.0, Kilometer).compare(Quantity(1.0, Kilogram)), Qt::partial_ordering::unordered);
+    QCOMPARE(Quantity(qQNaN(), Meter).compare(Quantity(1.0, Meter)), Qt::partial_ordering::unordered);
+
+    QVERIFY(Quantity(1.0, Kilometer) == Quantity(1.0, Kilometer));
+    QVERIFY(Quantity(1.0, Kilometer) != Quantity(1000.0, Meter));
+}
+
+void QuantityTest::testValue()
+{
+    const Value value(3.1415, Kilometer);
+    const Quantity q(value);
+    QCOMPARE(q.number(), 3.1415);
+    QCOMPARE(q.unitId(), Kilometer);
+    QCOMPARE(q.toValue(), value);
+    QCOMPARE(q.unit(), value.unit());
+    QCOMPARE(q.convertTo(Meter).toValue(), value.convertTo(Meter));
+}
+
+void QuantityTest::testFromString_data()
+{
+    QTest::addColumn<QString>("text");
+    QTest::addColumn<QString>("locale");
+    QTest::addColumn<qreal>("number");
+    QTest::addColumn<int>("unitId");
+
+    QTest::newRow("symbol") << QStringLiteral("12.5 km/h") << QStringLiteral("C") << 12.5 << int(KilometerPerHour);
+    QTest::newRow("no space") << QStringLiteral("12.5km/h") << QStringLiteral("C") << 12.5 << int(KilometerPerHour);
+    QTest::newRow("exponent") << QStringLiteral("  -3e2 m ") << QStringLiteral("C") << -300.0 << int(Meter);
+    QTest::newRow("synonym") << QStringLiteral("2 kilometers") << QStringLiteral("C") << 2.0 << int(Kilometer);
+    QTest::newRow("locale decimal") << QStringLiteral("1,5 km") << QStringLiteral("de_DE") << 1.5 << int(Kilometer);
+    QTest::newRow("locale group") << QStringLiteral("1.234,5 m") << QStringLiteral("de_DE") << 1234.5 << int(Meter);
+    QTest::newRow("c fallback") << QStringLiteral("1.5 km") << QStringLiteral("de_DE") << 1.5 << int(Kilometer);
+    QTest::newRow("number in unit") << QStringLiteral("8 l/100 km") << QStringLiteral("C") << 8.0 << int(LitersPer100Kilometers);
+    QTest::newRow("compound") << QStringLiteral("3 ft 4 in") << QStringLiteral("C") << 3.0 + 4.0 / 12.0 << int(Foot);
+    QTest::newRow("negative compound") << QStringLiteral("-3 ft 6 in") << QStringLiteral("C") << -3.5 << int(Foot);
+    QTest::newRow("metric compound") << QStringLiteral("5 m 20 cm") << QStringLiteral("C") << 5.2 << int(Meter);
+    QTest::newRow("temperature") << QStringLiteral("100 °C") << QStringLiteral("C") << 100.0 << int(Celsius);
+}
+
+void QuantityTest::testFromString()
+{
+    QFETCH(QString, text);
+    QFETCH(QString, locale);
+    QFETCH(qreal, number);
+    QFETCH(int, unitId);
+
+    const Quantity q = Quantity::fromString(text, QLocale(locale));
+    QCOMPARE(q.unitId(), UnitId(unitId));
+    QCOMPARE(q.number(), number);
+    QCOMPARE(Quantity::fromString(text, QLocale(locale)).toValue(), Value(number, UnitId(unitId)));
+}
+
+void QuantityTest::testInvalid()
+{
+    QVERIFY(!Quantity().isValid());
+    QCOMPARE(Quantity().unitId(), InvalidUnit);
+    QVERIFY(Quantity().unit().isNull());
+    QVERIFY(Quantity().toValue().isNull());
+    QVERIFY(Quantity().toString().isEmpty());
+    QVERIFY(Quantity(Value()).unitId() == InvalidUnit);
+
+    for (const char *text : {"", "km", "12", "12 does not exist", "3 ft 4 kg", "3 ft -4 in", "e3 m"}) {
+        QVERIFY2(!Quantity::fromString(QString::fromUtf8(text)).isValid(), text);
+    }
+
+    const Quantity q = Quantity(1.0, Kilometer).convertTo(UnitId(99999));
+    QVERIFY(!q.isValid());
+    QVERIFY(qIsNaN(q.number()));
+    QVERIFY(qIsNaN(Quantity(1.0, Kilometer).convertTo(Kilogram).number()));
+    QVERIFY(!Quantity(1.0, UnitId(99999)).isValid());
+}
+
+QTEST_MAIN(QuantityTest)
+
+#include "moc_quantitytest.cpp"
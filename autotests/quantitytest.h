@@ -0,0 +1,27 @@
+/*
+ *   SPDX-FileCopyrightText: 2026 KUnitConversion Authors
+ *
+ *   SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#ifndef QUANTITYTEST_H
+#define QUANTITYTEST_H
+
+#include <QObject>
+#include <QTest>
+
+class QuantityTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void initTestCase();
+    void testStrings();
+    void testConvert();
+    void testCompare();
+    void testValue();
+    void testFromString_data();
+    void testFromString();
+    void testInvalid();
+};
+
+#endif // QUANTITYTEST_H
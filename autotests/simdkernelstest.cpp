@@ -0,0 +1,225 @@
+/*
+ *   SPDX-FileCopyrightText: 2026 KUnitConversion Authors
+ *
+ *   SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#include "simdkernelstest.h"
+#include <QList>
+#include <cmath>
+#include <cstring>
+#include <kunitconversion/converter.h>
+#include <kunitconversion/quantity.h>
+#include <kunitconversion/unitcategory.h>
+#include <kunitconversion/value.h>
+#include <limits>
+#include <simdkernels_p.h>
+
+using namespace KUnitConversion;
+
+template<typename T>
+static QList<T> testNumbers()
+{
+    // odd count, so that every vector width leaves a remainder
+    QList<T> numbers;
+    for (int i = 0; i < 67; ++i) {
+        numbers.append(T((i % 2 ? -1.0 : 1.0) * std::pow(1.37, i - 30) + i * 0.1));
+    }
+    numbers[3] = T(-0.0);
+    numbers[5] = std::numeric_limits<T>::infinity();
+    numbers[7] = std::numeric_limits<T>::quiet_NaN();
+    numbers[9] = std::numeric_limits<T>::denorm_min();
+    numbers[11] = std::numeric_limits<T>::max();
+    return numbers;
+}
+
+template<typename T>
+static bool identical(const QList<T> &a, const QList<T> &b)
+{
+    return a.size() == b.size() && std::memcmp(a.constData(), b.constData(), a.size() * sizeof(T)) == 0;
+}
+
+void SimdKernelsTest::testKernels_data()
+{
+    QTest::addColumn<int>("level");
+
+    QTest::newRow("scalar") << int(Simd::Scalar);
+    if (Simd::supportedLevel() >= Simd::Sse2) {
+        QTest::newRow("sse2") << int(Simd::Sse2);
+    }
+    if (Simd::supportedLevel() >= Simd::Avx2) {
+        QTest::newRow("avx2") << int(Simd::Avx2);
+    }
+    if (Simd::supportedLevel() >= Simd::Avx512) {
+        QTest::newRow("avx512") << int(Simd::Avx512);
+    }
+}
+
+void SimdKernelsTest::testKernels()
+{
+    QFETCH(int, level);
+    const auto simdLevel = static_cast<Simd::Level>(level);
+
+    const QList<double> numbers = testNumbers<double>();
+    const QList<float> floatNumbers = testNumbers<float>();
+    for (qsizetype size = 0; size <= numbers.size(); ++size) {
+        QList<double> expected(size);
+        QList<double> result(size);
+        Simd::scale(Simd::Scalar, numbers.constData(), expected.data(), size, 0.3048);
+        Simd::scale(simdLevel, numbers.constData(), result.data(), size, 0.3048);
+        QVERIFY(identical(result, expected));
+
+        Simd::affine(Simd::Scalar, numbers.constData(), expected.data(), size, 5.0 / 9.0, 459.67 * 5.0 / 9.0);
+        Simd::affine(simdLevel, numbers.constData(), result.data(), size, 5.0 / 9.0, 459.67 * 5.0 / 9.0);
+        QVERIFY(identical(result, expected));
+
+        // in place
+        result = numbers.first(size);
+        Simd::affine(simdLevel, result.constData(), result.data(), size, 5.0 / 9.0, 459.67 * 5.0 / 9.0);
+        QVERIFY(identical(result, expected));
+
+        QList<float> floatExpected(size);
+        QList<float> floatResult(size);
+        Simd::scale(Simd::Scalar, floatNumbers.constData(), floatExpected.data(), size, 1e-3);
+        Simd::scale(simdLevel, floatNumbers.constData(), floatResult.data(), size, 1e-3);
+        QVERIFY(identical(floatResult, floatExpected));
+
+        Simd::affine(Simd::Scalar, floatNumbers.constData(), floatExpected.data(), size, 1.8, 32.0);
+        Simd::affine(simdLevel, floatNumbers.constData(), floatResult.data(), size, 1.8, 32.0);
+        QVERIFY(identical(floatResult, floatExpected));
+    }
+}
+
+void SimdKernelsTest::testConversionPlans()
+{
+    // batch conversions must match converting value by value with ConversionPlan exactly
+    Converter c;
+    const QList<double> numbers = testNumbers<double>();
+    const QList<float> floatNumbers = testNumbers<float>();
+    const auto categories = c.categories();
+    for (const UnitCategory &category : categories) {
+        if (category.hasOnlineConversionTable()) {
+            continue;
+        }
+        const auto units = category.units();
+        for (const Unit &fromUnit : units) {
+            for (const Unit &toUnit : units) {
+                const ConversionPlan plan(fromUnit, toUnit);
+                QVERIFY(plan.isValid());
+
+                QList<double> expected;
+                for (double number : numbers) {
+                    expected.append(plan.convert(number));
+                }
+                QList<double> result(numbers.size());
+                QVERIFY(plan.convert(numbers, result));
+                for (qsizetype i = 0; i < numbers.size(); ++i) {
+                    // NaN payloads are not specified
+                    if (std::isnan(expected[i])) {
+                        QVERIFY(std::isnan(result[i]));
+                        result[i] = expected[i];
+                    }
+                }
+                QVERIFY2(identical(result, expected), qPrintable(fromUnit.symbol() + QLatin1String(" -> ") + toUnit.symbol()));
+
+                QList<float> floatExpected;
+                for (float number : floatNumbers) {
+                    floatExpected.append(float(plan.convert(number)));
+                }
+                QList<float> floatResult(floatNumbers.size());
+                QVERIFY(c.convert(floatNumbers, fromUnit.id(), toUnit.id(), floatResult));
+                for (qsizetype i = 0; i < floatNumbers.size(); ++i) {
+                    if (std::isnan(floatExpected[i])) {
+                        QVERIFY(std::isnan(floatResult[i]));
+                        floatResult[i] = floatExpected[i];
+                    }
+                }
+                QVERIFY2(identical(floatResult, floatExpected), qPrintable(fromUnit.symbol() + QLatin1String(" -> ") + toUnit.symbol()));
+            }
+        }
+    }
+}
+
+void SimdKernelsTest::testQuantities()
+{
+    // Quantity converts with the scalar kernel inlined into another translation
+    // unit than the vectorized kernels, both must still round the same
+    Converter c;
+    const QList<double> numbers = testNumbers<double>();
+    const auto categories = c.categories();
+    for (const UnitCategory &category : categories) {
+        if (category.hasOnlineConversionTable()) {
+            continue;
+        }
+        const auto units = category.units();
+        for (const Unit &fromUnit : units) {
+            for (const Unit &toUnit : units) {
+                QList<double> expected;
+                for (double number : numbers) {
+                    expected.append(Quantity(number, fromUnit.id()).convertTo(toUnit.id()).number());
+                }
+                QList<double> result(numbers.size());
+                QVERIFY(c.convert(numbers, fromUnit.id(), toUnit.id(), result));
+                for (qsizetype i = 0; i < numbers.size(); ++i) {
+                    if (std::isnan(expected[i])) {
+                        QVERIFY(std::isnan(result[i]));
+                        result[i] = expected[i];
+                    }
+                }
+                QVERIFY2(identical(result, expected), qPrintable(fromUnit.symbol() + QLatin1String(" -> ") + toUnit.symbol()));
+            }
+        }
+    }
+}
+
+// the deviation from Value::convertTo() that ConversionPlan documents
+static bool withinDocumentedBound(double converted, double number, const Unit &fromUnit, const Unit &toUnit)
+{
+    const double expected = Value(number, fromUnit).convertTo(toUnit).number();
+    if (converted == expected || (std::isnan(converted) && std::isnan(expected))) {
+        return true;
+    }
+    const auto magnitude = [](double n) {
+        return std::isfinite(n) ? std::abs(n) : 0.0;
+    };
+    const double zeroPoints = magnitude(Value(0.0, fromUnit).convertTo(toUnit).number())
+        + magnitude(Value(0.0, fromUnit.category().defaultUnit()).convertTo(toUnit).number());
+    return std::abs(converted - expected) <= 4 * std::numeric_limits<double>::epsilon() * (magnitude(expected) + zeroPoints);
+}
+
+void SimdKernelsTest::testValues()
+{
+    // the vectorized kernels and Quantity fold the conversion into one operation, they may
+    // only differ from converting through the default unit as Value does by the documented bound
+    Converter c;
+    QList<double> numbers;
+    for (double number : testNumbers<double>()) {
+        // not the extremes, where converting in two steps overflows or underflows first
+        if (number == 0.0 || (std::isnormal(number) && std::abs(number) < 1e100)) {
+            numbers.append(number);
+        }
+    }
+    const auto categories = c.categories();
+    for (const UnitCategory &category : categories) {
+        if (category.hasOnlineConversionTable()) {
+            continue;
+        }
+        const auto units = category.units();
+        for (const Unit &fromUnit : units) {
+            for (const Unit &toUnit : units) {
+                QList<double> result(numbers.size());
+                QVERIFY(c.convert(numbers, fromUnit.id(), toUnit.id(), result));
+                for (qsizetype i = 0; i < numbers.size(); ++i) {
+                    const QString pair = QString::number(numbers[i]) + QLatin1Char(' ') + fromUnit.symbol() + QLatin1String(" -> ") + toUnit.symbol();
+                    QVERIFY2(withinDocumentedBound(result[i], numbers[i], fromUnit, toUnit), qPrintable(pair));
+                    const double quantity = Quantity(numbers[i], fromUnit.id()).convertTo(toUnit.id()).number();
+                    QVERIFY2(withinDocumentedBound(quantity, numbers[i], fromUnit, toUnit), qPrintable(pair));
+                }
+            }
+        }
+    }
+}
+
+QTEST_MAIN(SimdKernelsTest)
+
+#include "moc_simdkernelstest.cpp"
@@ -0,0 +1,24 @@
+/*
+ *   SPDX-FileCopyrightText: 2026 KUnitConversion Authors
+ *
+ *   SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#ifndef SIMDKERNELSTEST_H
+#define SIMDKERNELSTEST_H
+
+#include <QObject>
+#include <QTest>
+
+class SimdKernelsTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void testKernels_data();
+    void testKernels();
+    void testConversionPlans();
+    void testQuantities();
+    void testValues();
+};
+
+#endif // SIMDKERNELSTEST_H
@@ -0,0 +1,121 @@
+/*
+ *   SPDX-FileCopyrightText: 2026 KUnitConversion Authors
+ *
+ *   SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#include "typedquantitytest.h"
+
+#include <QStandardPaths>
+#include <kunitconversion/typedquantity.h>
+
+#include <type_traits>
+
+using namespace KUnitConversion;
+
+using Meters = TypedQuantity<LengthCategory, Meter>;
+using Kilometers = TypedQuantity<LengthCategory, Kilometer>;
+using Miles = TypedQuantity<LengthCategory, Mile>;
+using Kilograms = TypedQuantity<MassCategory, Kilogram>;
+using DegreesCelsius = TypedQuantity<TemperatureCategory, Celsius>;
+using DegreesFahrenheit = TypedQuantity<TemperatureCategory, Fahrenheit>;
+using DecibelWatts = TypedQuantity<PowerCategory, DecibelWatt>;
+
+template<typename Lhs, typename Rhs>
+concept Addable = requires(Lhs lhs, Rhs rhs) { lhs + rhs; };
+
+static_assert(std::is_trivially_copyable_v<Meters>);
+static_assert(sizeof(Meters) == sizeof(qreal));
+static_assert(Meters::categoryId() == LengthCategory);
+static_assert(Kilometers::unitId() == Kilometer);
+static_assert(Meters(Kilometers(1.5)).number() == 1500.0);
+static_assert(Kilometers(2.0).convertTo<Meter>().number() == 2000.0);
+static_assert(Meters(500.0) + Kilometers(1.0) == Meters(1500.0));
+static_assert(std::is_convertible_v<Kilometers, Meters>);
+static_assert(!std::is_convertible_v<Kilograms, Meters>);
+static_assert(!std::is_constructible_v<Meters, Kilograms>);
+static_assert(Addable<Meters, Kilometers>);
+static_assert(!Addable<Meters, Kilograms>);
+static_assert(!Addable<Meters, qreal>);
+static_assert(Addable<DecibelWatts, DecibelWatts>);
+
+void TypedQuantityTest::initTestCase()
+{
+    qputenv("KFUNITCONVERT_NO_DOWNLOAD", "1");
+    QStandardPaths::setTestModeEnabled(true);
+    QLocale::setDefault(QLocale::c());
+}
+
+void TypedQuantityTest::testConvert()
+{
+    const Meters meters = Miles(1.0);
+    QCOMPARE(meters.number(), Value(1.0, Mile).convertTo(Meter).number());
+    QCOMPARE(DegreesFahrenheit(DegreesCelsius(100.0)).number(), 212.0);
+    QCOMPARE(DegreesCelsius(DegreesFahrenheit(-40.0)).number(), -40.0);
+
+    using LitersPer100Km = TypedQuantity<FuelEfficiencyCategory, LitersPer100Kilometers>;
+    using MilesPerGallon = TypedQuantity<FuelEfficiencyCategory, MilePerUsGallon>;
+    QCOMPARE(MilesPerGallon(LitersPer100Km(8.0)).number(), 29.401875);
+}
+
+void TypedQuantityTest::testArithmetic()
+{
+    // results are in the unit of the left hand side
+    const auto sum = Kilometers(1.0) + Meters(500.0);
+    static_assert(std::is_same_v<decltype(sum), const Kilometers>);
+    QCOMPARE(sum.number(), 1.5);
+    QCOMPARE((Meters(500.0) + Kilometers(1.0)).number(), 1500.0);
+    QCOMPARE((Kilometers(2.0) - Meters(500.0)).number(), 1.5);
+    QCOMPARE((-Meters(2.0)).number(), -2.0);
+    QCOMPARE((Meters(2.0) * 3.0).number(), 6.0);
+    QCOMPARE((3.0 * Meters(2.0)).number(), 6.0);
+    QCOMPARE((Meters(6.0) / 3.0).number(), 2.0);
+    QCOMPARE(Kilometers(3.0) / Meters(1500.0), 2.0);
+
+    Meters total;
+    total += Kilometers(1.0);
+    total -= Meters(250.0);
+    total *= 2.0;
+    total /= 4.0;
+    QCOMPARE(total.number(), 375.0);
+
+    // units only convertible at runtime work as long as they are not mixed
+    QCOMPARE((DecibelWatts(3.0) + DecibelWatts(4.0)).number(), 7.0);
+}
+
+void TypedQuantityTest::testCompare()
+{
+    QVERIFY(Kilometers(1.0) == Meters(1000.0));
+    QVERIFY(Kilometers(1.0) != Meters(999.0));
+    QVERIFY(Kilometers(1.0) > Meters(999.0));
+    QVERIFY(Meters(999.0) < Kilometers(1.0));
+    QVERIFY(Meters(1000.0) <= Kilometers(1.0));
+    QVERIFY(Kilometers(1.0) >= Meters(1000.0));
+    QVERIFY(Meters(qQNaN()) != Meters(qQNaN()));
+    QVERIFY(DegreesCelsius(0.0) > DegreesFahrenheit(0.0));
+    QCOMPARE(Meters(qQNaN()) <=> Meters(1.0), std::partial_ordering::unordered);
+}
+
+void TypedQuantityTest::testValue()
+{
+    const Value value = Kilometers(1.5).toValue();
+    QCOMPARE(value, Value(1.5, Kilometer));
+    QCOMPARE(Meters::fromValue(value).number(), 1500.0);
+    QCOMPARE(Meters::fromValue(Value(1.0, Mile)).number(), Value(1.0, Mile).convertTo(Meter).number());
+    QVERIFY(qIsNaN(Meters::fromValue(Value(1.0, Kilogram)).number()));
+    QVERIFY(qIsNaN(Meters::fromValue(Value()).number()));
+}
+
+void TypedQuantityTest::testQuantity()
+{
+    const Quantity quantity = Kilometers(1.5);
+    QCOMPARE(quantity, Quantity(1.5, Kilometer));
+    QCOMPARE(Meters::fromQuantity(quantity).number(), 1500.0);
+    QCOMPARE(Kilometers::fromQuantity(quantity).number(), 1.5);
+    QVERIFY(qIsNaN(Meters::fromQuantity(Quantity(1.0, Kilogram)).number()));
+    QVERIFY(qIsNaN(Meters::fromQuantity(Quantity()).number()));
+}
+
+QTEST_MAIN(TypedQuantityTest)
+
+#include "moc_typedquantitytest.cpp"
@@ -0,0 +1,25 @@
+/*
+ *   SPDX-FileCopyrightText: 2026 KUnitConversion Authors
+ *
+ *   SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#ifndef TYPEDQUANTITYTEST_H
+#define TYPEDQUANTITYTEST_H
+
+#include <QObject>
+#include <QTest>
+
+class TypedQuantityTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void initTestCase();
+    void testConvert();
+    void testArithmetic();
+    void testCompare();
+    void testValue();
+    void testQuantity();
+};
+
+#endif // TYPEDQUANTITYTEST_H
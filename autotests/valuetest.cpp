@@ -6,6 +6,8 @@
 
 #include "valuetest.h"
 
+#include <KLocalizedString>
+
 #include <QStandardPaths>
 
 using namespace KUnitConversion;
@@ -28,12 +30,103 @@ void ValueTest::testStrings()
     QCOMPARE(v3.toString(), QStringLiteral("9.1415 kilometers"));
 }
 
+void ValueTest::testAppendStrings()
+{
+    const Unit unit = v1.unit();
+    QString buffer = QStringLiteral("a");
+    unit.appendSymbolString(buffer, 2.5);
+    unit.appendString(buffer, 3);
+    unit.appendString(buffer, 0.25, 0, 'f', 3);
+    QCOMPARE(buffer, QStringLiteral("a2.5 km3 kilometers0.250 kilometers"));
+    QCOMPARE(unit.toSymbolString(1.5, 6, 'f', 1), QStringLiteral("   1.5 km"));
+    QCOMPARE(unit.toSymbolString(-1.5, 6, 'f', 1, QLatin1Char('0')), QStringLiteral("-001.5 km"));
+
+    // the cached formats follow the default locale
+    QLocale::setDefault(QLocale(QLocale::German, QLocale::Germany));
+    QCOMPARE(unit.toSymbolString(1234.5, 0, 'f', 1), QStringLiteral("1.234,5 km"));
+    QCOMPARE(unit.toString(2.5), QStringLiteral("2,5 kilometers"));
+    QLocale::setDefault(QLocale::c());
+    QCOMPARE(unit.toSymbolString(1234.5, 0, 'f', 1), QStringLiteral("1234.5 km"));
+
+    buffer.clear();
+    Unit().appendSymbolString(buffer, 1);
+    QVERIFY(buffer.isEmpty());
+}
+
+void ValueTest::testTranslatedStrings()
+{
+#ifdef TRANSLATIONS_DIR
+    KLocalizedString::addDomainLocaleDir("kunitconversion6", QStringLiteral(TRANSLATIONS_DIR));
+    const Unit unit = v1.unit();
+    QCOMPARE(unit.toString(2.5), QStringLiteral("2.5 kilometers"));
+
+    // the cached formats follow the translation languages
+    KLocalizedString::setLanguages({QStringLiteral("de")});
+    QCOMPARE(unit.toString(2.5), QStringLiteral("2.5 Kilometer"));
+    KLocalizedString::clearLanguages();
+    QCOMPARE(unit.toString(2.5), QStringLiteral("2.5 kilometers"));
+#else
+    QSKIP("the translations for the test could not be compiled");
+#endif
+}
+
+void ValueTest::testShortestStrings()
+{
+    constexpr int shortest = QLocale::FloatingPointShortest;
+    const qreal number = 0.1 + 0.2;
+    const Value value(number, Kilometer);
+    QCOMPARE(value.toSymbolString(0, 'g', shortest), QStringLiteral("0.30000000000000004 km"));
+    QCOMPARE(value.toString(0, 'g', shortest), QStringLiteral("0.30000000000000004 kilometers"));
+    QCOMPARE(Value(-1.5e-7, Kilometer).toSymbolString(0, 'e', shortest), QStringLiteral("-1.5e-07 km"));
+    QCOMPARE(Value(1e21, Kilometer).toSymbolString(0, 'G', shortest), QStringLiteral("1E+21 km"));
+    QCOMPARE(Value(1234.5, Kilometer).toSymbolString(0, 'f', shortest), QStringLiteral("1234.5 km"));
+    QCOMPARE(Value(qInf(), Kilometer).toSymbolString(0, 'g', shortest), QStringLiteral("inf km"));
+
+    // reads back as exactly the same number
+    QString buffer;
+    value.appendSymbolString(buffer, 0, 'g', shortest);
+    QCOMPARE(QLocale::c().toDouble(QStringView(buffer).chopped(3)), number);
+
+    QLocale::setDefault(QLocale(QLocale::German, QLocale::Germany));
+    buffer.clear();
+    value.appendString(buffer, 0, 'f', shortest);
+    QCOMPARE(buffer, QStringLiteral("0,30000000000000004 kilometers"));
+    QCOMPARE(Value(-1234.5, Kilometer).toSymbolString(0, 'f', shortest), QStringLiteral("-1234,5 km"));
+    QLocale::setDefault(QLocale::c());
+}
+
 void ValueTest::testRound()
 {
     v1.round(2);
     QCOMPARE(v1.number(), 3.14);
 }
 
+void ValueTest::testBestUnit()
+{
+    const QList<std::tuple<qreal, UnitId, qreal, UnitId>> rows = {
+        {0.02, Kilometer, 20, Meter},
+        {5, Centimeter, 50, Millimeter},
+        {1e-20, Meter, 10, Zeptometer},
+        {1e-30, Meter, 1e-6, Yoctometer},
+        {-2500, Watt, -2.5, Kilowatt},
+        {90, Minute, 1.5, Hour},
+        {0.25, Minute, 15, Second},
+        {1536, Kibibyte, 1.5, Mebibyte},
+        {2000, Kilobyte, 2, Megabyte},
+        {2048, Byte, 2, Kibibyte},
+        {4096, Bit, 4, Kibibit},
+        {1000, Kilobit, 1, Megabit},
+        {0, Kilometer, 0, Kilometer},
+        {5280, Foot, 5280, Foot},
+    };
+    for (const auto &[number, unitId, bestNumber, bestUnitId] : rows) {
+        const Value best = Value(number, unitId).toBestUnit();
+        QCOMPARE(best.unit().id(), bestUnitId);
+        QCOMPARE(best.number(), bestNumber);
+    }
+    QVERIFY(!Value().toBestUnit().isValid());
+}
+
 void ValueTest::testConvert()
 {
     v1 = v1.convertTo(Meter);
@@ -42,6 +135,9 @@ void ValueTest::testConvert()
     QCOMPARE(v1.number(), 314000.0);
     v1 = v1.convertTo(v2.unit());
     QCOMPARE(v1.number(), 3140.0);
+    QVERIFY(v1.numberIn(Mile) == v1.convertTo(Mile).number());
+    QVERIFY(qIsNaN(v1.numberIn(Kilogram)));
+    QVERIFY(qIsNaN(Value().numberIn(Meter)));
 }
 
 void ValueTest::testConvertEnergy()
@@ -19,7 +19,11 @@ class ValueTest : public QObject
 private Q_SLOTS:
     void initTestCase();
     void testStrings();
+    void testAppendStrings();
+    void testShortestStrings();
+    void testTranslatedStrings();
     void testRound();
+    void testBestUnit();
     void testConvert();
     void testConvertEnergy();
     void testInvalid();
@@ -0,0 +1,535 @@
+/*
+ *   SPDX-FileCopyrightText: 2026 KUnitConversion Authors
+ *
+ *   SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#include "converterbenchmark.h"
+
+#include <QDir>
+#include <QFileInfo>
+#include <QList>
+#include <QStandardPaths>
+#include <QThread>
+#include <algorithm>
+#include <cmath>
+#include <currency_p.h>
+#include <kunitconversion/converter.h>
+#include <kunitconversion/quantity.h>
+#include <kunitconversion/typedquantity.h>
+#include <kunitconversion/unittable.h>
+
+using namespace KUnitConversion;
+
+static QString currencyTableLocation()
+{
+    return QStandardPaths::writableLocation(QStandardPaths::GenericDataLocation) + QStringLiteral("/libkunitconversion/currency.xml");
+}
+
+void ConverterBenchmark::initTestCase()
+{
+    qputenv("KFUNITCONVERT_NO_DOWNLOAD", "1");
+    QStandardPaths::setTestModeEnabled(true);
+    QLocale::setDefault(QLocale::c());
+
+    // use the bundled table, its rate cache gets written on the first currency conversion
+    const QString table = currencyTableLocation();
+    QDir().mkpath(QFileInfo(table).absolutePath());
+    QFile::remove(table);
+    QFile::remove(table + QStringLiteral(".rates"));
+    QVERIFY(QFile::copy(QStringLiteral(":/currency.xml"), table));
+}
+
+void ConverterBenchmark::benchmarkConverter()
+{
+    QBENCHMARK {
+        Converter c;
+        Q_UNUSED(c)
+    }
+}
+
+void ConverterBenchmark::benchmarkEnumerateUnits_data()
+{
+    QTest::addColumn<bool>("useViews");
+
+    QTest::newRow("lists") << false;
+    QTest::newRow("views") << true;
+}
+
+void ConverterBenchmark::benchmarkEnumerateUnits()
+{
+    QFETCH(bool, useViews);
+    const Converter &c = Converter::global();
+    qsizetype count = 0;
+    QBENCHMARK {
+        if (useViews) {
+            for (const UnitCategory &category : c.categoriesView()) {
+                count += category.unitsView().size();
+            }
+        } else {
+            const QList<UnitCategory> categories = c.categories();
+            for (const UnitCategory &category : categories) {
+                count += category.units().size();
+            }
+        }
+    }
+    QVERIFY(count > 0);
+}
+
+void ConverterBenchmark::benchmarkUnitByName_data()
+{
+    QTest::addColumn<QString>("name");
+
+    QTest::newRow("symbol") << QStringLiteral("km");
+    QTest::newRow("description") << QStringLiteral("kilometers");
+    QTest::newRow("synonym") << QStringLiteral("mpg (imperial)");
+    QTest::newRow("unknown") << QStringLiteral("furlongs per fortnight");
+}
+
+void ConverterBenchmark::benchmarkUnitByName()
+{
+    QFETCH(QString, name);
+    Converter c;
+    QBENCHMARK {
+        const Unit unit = c.unit(name);
+        Q_UNUSED(unit)
+    }
+}
+
+void ConverterBenchmark::benchmarkUnitById()
+{
+    Converter c;
+    QBENCHMARK {
+        const Unit unit = c.unit(Kilometer);
+        Q_UNUSED(unit)
+    }
+}
+
+void ConverterBenchmark::benchmarkUnitNamesStartingWith()
+{
+    // completing user input, one keystroke at a time
+    Converter converter;
+    const QString input = QStringLiteral("kilomet");
+    QVERIFY(!converter.unitNamesStartingWith(input).isEmpty());
+    QBENCHMARK {
+        for (qsizetype length = 1; length <= input.size(); ++length) {
+            const QStringList names = converter.unitNamesStartingWith(QStringView(input).first(length), Qt::CaseInsensitive, 10);
+            Q_UNUSED(names)
+        }
+    }
+}
+
+void ConverterBenchmark::benchmarkSimilarUnitNames_data()
+{
+    QTest::addColumn<QString>("name");
+
+    QTest::newRow("short") << QStringLiteral("kn");
+    QTest::newRow("misspelled") << QStringLiteral("kilomter");
+    QTest::newRow("long") << QStringLiteral("miles per imperial galon");
+    QTest::newRow("unknown") << QStringLiteral("qqqqqqqq");
+}
+
+void ConverterBenchmark::benchmarkSimilarUnitNames()
+{
+    QFETCH(QString, name);
+    Converter converter;
+    converter.similarUnitNames(name);
+    QBENCHMARK {
+        const QStringList names = converter.similarUnitNames(name);
+        Q_UNUSED(names)
+    }
+}
+
+void ConverterBenchmark::benchmarkValueById()
+{
+    QBENCHMARK {
+        const Value value(3.14, Kilometer);
+        Q_UNUSED(value)
+    }
+}
+
+void ConverterBenchmark::benchmarkValueByName()
+{
+    const QString name = QStringLiteral("km");
+    QBENCHMARK {
+        const Value value(3.14, name);
+        Q_UNUSED(value)
+    }
+}
+
+void ConverterBenchmark::benchmarkConvert_data()
+{
+    QTest::addColumn<int>("categoryId");
+
+    const auto categories = Converter().categories();
+    for (const UnitCategory &category : categories) {
+        QTest::newRow(qPrintable(category.name())) << int(category.id());
+    }
+}
+
+void ConverterBenchmark::benchmarkConvert()
+{
+    // converts a value in the default unit to every unit of the category
+    QFETCH(int, categoryId);
+    const UnitCategory category = Converter().category(CategoryId(categoryId));
+    const Value value(42.0, category.defaultUnit());
+    const auto units = category.units();
+    QBENCHMARK {
+        for (const Unit &unit : units) {
+            const Value converted = value.convertTo(unit);
+            Q_UNUSED(converted)
+        }
+    }
+}
+
+void ConverterBenchmark::benchmarkConvertQuantity_data()
+{
+    benchmarkConvert_data();
+}
+
+void ConverterBenchmark::benchmarkConvertQuantity()
+{
+    QFETCH(int, categoryId);
+    const UnitCategory category = Converter().category(CategoryId(categoryId));
+    const Quantity quantity(42.0, category.defaultUnit().id());
+    QList<UnitId> unitIds;
+    const auto units = category.units();
+    for (const Unit &unit : units) {
+        unitIds.append(unit.id());
+    }
+    QBENCHMARK {
+        for (UnitId unitId : std::as_const(unitIds)) {
+            const Quantity converted = quantity.convertTo(unitId);
+            Q_UNUSED(converted)
+        }
+    }
+}
+
+void ConverterBenchmark::benchmarkConvertTypedQuantity()
+{
+    using Kilometers = TypedQuantity<LengthCategory, Kilometer>;
+    using Miles = TypedQuantity<LengthCategory, Mile>;
+    QList<Kilometers> distances(100000);
+    for (qsizetype i = 0; i < distances.size(); ++i) {
+        distances[i] = Kilometers(i * 0.5);
+    }
+    QList<Miles> converted(distances.size());
+    QBENCHMARK {
+        std::copy(distances.cbegin(), distances.cend(), converted.begin());
+    }
+}
+
+void ConverterBenchmark::benchmarkConvertBatch_data()
+{
+    QTest::addColumn<int>("fromUnit");
+    QTest::addColumn<int>("toUnit");
+
+    QTest::newRow("scale") << int(Kilometer) << int(Mile);
+    QTest::newRow("affine") << int(Celsius) << int(Fahrenheit);
+    QTest::newRow("reciprocal") << int(LitersPer100Kilometers) << int(MilePerUsGallon);
+    QTest::newRow("generic") << int(Watt) << int(DecibelWatt);
+}
+
+void ConverterBenchmark::benchmarkConvertBatch()
+{
+    QFETCH(int, fromUnit);
+    QFETCH(int, toUnit);
+    Converter c;
+    QList<qreal> input(100000);
+    for (qsizetype i = 0; i < input.size(); ++i) {
+        input[i] = i * 0.5;
+    }
+    QList<qreal> output(input.size());
+    QBENCHMARK {
+        c.convert(input, UnitId(fromUnit), UnitId(toUnit), output);
+    }
+}
+
+void ConverterBenchmark::benchmarkConvertMixedUnits_data()
+{
+    QTest::addColumn<bool>("batch");
+
+    QTest::newRow("values") << false;
+    QTest::newRow("batch") << true;
+}
+
+void ConverterBenchmark::benchmarkConvertMixedUnits()
+{
+    QFETCH(bool, batch);
+    Converter c;
+    const UnitId units[] = {Kilogram, Pound, Ounce, Gram};
+    QList<qreal> input(100000);
+    QList<UnitId> inputUnits(input.size());
+    for (qsizetype i = 0; i < input.size(); ++i) {
+        input[i] = i * 0.5;
+        inputUnits[i] = units[i % std::size(units)];
+    }
+    QList<qreal> output(input.size());
+    QBENCHMARK {
+        if (batch) {
+            c.convert(input, inputUnits, Kilogram, output);
+        } else {
+            for (qsizetype i = 0; i < input.size(); ++i) {
+                output[i] = Value(input[i], inputUnits[i]).convertTo(Kilogram).number();
+            }
+        }
+    }
+}
+
+void ConverterBenchmark::benchmarkConvertConstexpr()
+{
+    // same input as the "scale" row of benchmarkConvertBatch
+    QList<qreal> input(100000);
+    for (qsizetype i = 0; i < input.size(); ++i) {
+        input[i] = i * 0.5;
+    }
+    QList<qreal> output(input.size());
+    QBENCHMARK {
+        std::transform(input.cbegin(), input.cend(), output.begin(), convert<Kilometer, Mile>);
+    }
+}
+
+void ConverterBenchmark::benchmarkConvertToAll_data()
+{
+    QTest::addColumn<int>("categoryId");
+    QTest::addColumn<int>("unitId");
+    QTest::addColumn<bool>("fanOut");
+
+    QTest::newRow("scale, one by one") << int(LengthCategory) << int(Mile) << false;
+    QTest::newRow("scale, fan-out") << int(LengthCategory) << int(Mile) << true;
+    QTest::newRow("affine, one by one") << int(TemperatureCategory) << int(Fahrenheit) << false;
+    QTest::newRow("affine, fan-out") << int(TemperatureCategory) << int(Fahrenheit) << true;
+}
+
+void ConverterBenchmark::benchmarkConvertToAll()
+{
+    QFETCH(int, categoryId);
+    QFETCH(int, unitId);
+    QFETCH(bool, fanOut);
+    const UnitCategory category = Converter::global().category(CategoryId(categoryId));
+    const QSpan<const Unit> units = category.unitsView();
+    const Value value(26.2, UnitId(unitId));
+    QList<qreal> output(units.size());
+    QBENCHMARK {
+        if (fanOut) {
+            category.convertToAll(value, output);
+        } else {
+            for (qsizetype i = 0; i < units.size(); ++i) {
+                output[i] = value.convertTo(units[i]).number();
+            }
+        }
+    }
+}
+
+namespace
+{
+class ConvertThread : public QThread
+{
+public:
+    enum Api {
+        ValueApi,
+        NumberApi,
+        QuantityApi,
+    };
+
+    ConvertThread(int count, Api api)
+        : m_count(count)
+        , m_api(api)
+    {
+    }
+
+    void run() override
+    {
+        const Value value(1.5, Kilometer);
+        const Quantity quantity(1.5, Kilometer);
+        switch (m_api) {
+        case ValueApi:
+            for (int i = 0; i < m_count; ++i) {
+                m_sum += value.convertTo(Mile).number();
+            }
+            break;
+        case NumberApi:
+            for (int i = 0; i < m_count; ++i) {
+                m_sum += value.numberIn(Mile);
+            }
+            break;
+        case QuantityApi:
+            for (int i = 0; i < m_count; ++i) {
+                m_sum += quantity.convertTo(Mile).number();
+            }
+            break;
+        }
+    }
+
+    int m_count;
+    Api m_api;
+    qreal m_sum = 0.0;
+};
+}
+
+void ConverterBenchmark::benchmarkConvertThreads_data()
+{
+    QTest::addColumn<int>("threadCount");
+    QTest::addColumn<int>("api");
+
+    for (int threadCount : {1, 2, 4, 8, 16}) {
+        QTest::addRow("value, %d threads", threadCount) << threadCount << int(ConvertThread::ValueApi);
+        QTest::addRow("number, %d threads", threadCount) << threadCount << int(ConvertThread::NumberApi);
+        QTest::addRow("quantity, %d threads", threadCount) << threadCount << int(ConvertThread::QuantityApi);
+    }
+}
+
+void ConverterBenchmark::benchmarkConvertThreads()
+{
+    QFETCH(int, threadCount);
+    QFETCH(int, api);
+    // build the category outside of the measurement
+    Converter::global().unit(Mile);
+    // every thread does the same work, so the time stays flat for as many
+    // threads as there are cores if conversions scale linearly
+    QBENCHMARK {
+        QList<ConvertThread *> threads;
+        for (int i = 0; i < threadCount; ++i) {
+            threads.append(new ConvertThread(100000, ConvertThread::Api(api)));
+        }
+        for (ConvertThread *thread : std::as_const(threads)) {
+            thread->start();
+        }
+        for (ConvertThread *thread : std::as_const(threads)) {
+            thread->wait();
+        }
+        qDeleteAll(threads);
+    }
+}
+
+static void addSimpleQuantityRows()
+{
+    QTest::addColumn<QString>("text");
+
+    QTest::newRow("symbol") << QStringLiteral("12.5 km/h");
+    QTest::newRow("synonym") << QStringLiteral("1.5 kilometers");
+    QTest::newRow("number in unit") << QStringLiteral("8 l/100 km");
+}
+
+void ConverterBenchmark::benchmarkToBestUnit()
+{
+    const Value value(1536.0 * 1024.0, Kibibyte);
+    QBENCHMARK {
+        const Value best = value.toBestUnit();
+        Q_UNUSED(best)
+    }
+}
+
+void ConverterBenchmark::benchmarkToBestUnits()
+{
+    Converter converter;
+    QList<qreal> input(10000);
+    for (qsizetype i = 0; i < input.size(); ++i) {
+        input[i] = std::pow(2.0, i % 60);
+    }
+    QList<qreal> output(input.size());
+    QList<UnitId> units(input.size());
+    QBENCHMARK {
+        converter.toBestUnits(input, Byte, output, units);
+    }
+}
+
+void ConverterBenchmark::benchmarkParse_data()
+{
+    addSimpleQuantityRows();
+    QTest::newRow("compound") << QStringLiteral("3 ft 4 in");
+}
+
+void ConverterBenchmark::benchmarkParse()
+{
+    QFETCH(QString, text);
+    QVERIFY(Quantity::fromString(text).isValid());
+    QBENCHMARK {
+        const Quantity quantity = Quantity::fromString(text);
+        Q_UNUSED(quantity)
+    }
+}
+
+void ConverterBenchmark::benchmarkParseSplit_data()
+{
+    addSimpleQuantityRows();
+}
+
+void ConverterBenchmark::benchmarkParseSplit()
+{
+    // what callers had to do before Quantity::fromString(), only works for a single number and unit
+    QFETCH(QString, text);
+    Converter converter;
+    QBENCHMARK {
+        const qsizetype space = text.indexOf(QLatin1Char(' '));
+        const Value value(text.left(space).toDouble(), converter.unit(text.mid(space + 1)));
+        Q_UNUSED(value)
+    }
+}
+
+void ConverterBenchmark::benchmarkToString()
+{
+    const Unit unit = Converter().unit(Kilometer);
+    QBENCHMARK {
+        const QString string = unit.toString(3.1415);
+        Q_UNUSED(string)
+    }
+}
+
+void ConverterBenchmark::benchmarkToSymbolString()
+{
+    const Unit unit = Converter().unit(Kilometer);
+    QBENCHMARK {
+        const QString string = unit.toSymbolString(3.1415);
+        Q_UNUSED(string)
+    }
+}
+
+void ConverterBenchmark::benchmarkAppendSymbolString()
+{
+    const Unit unit = Converter().unit(Kilometer);
+    QString table;
+    QBENCHMARK {
+        table.clear();
+        for (int i = 0; i < 10000; ++i) {
+            unit.appendSymbolString(table, i + 0.5);
+            table.append(QLatin1Char('\n'));
+        }
+    }
+}
+
+void ConverterBenchmark::benchmarkAppendShortestSymbolString()
+{
+    const Unit unit = Converter().unit(Kilometer);
+    QString table;
+    QBENCHMARK {
+        table.clear();
+        for (int i = 0; i < 10000; ++i) {
+            unit.appendSymbolString(table, i / 3.0, 0, 'g', QLocale::FloatingPointShortest);
+            table.append(QLatin1Char('\n'));
+        }
+    }
+}
+
+void ConverterBenchmark::benchmarkCurrencyRateCache()
+{
+    const QString table = currencyTableLocation();
+    QVERIFY(!std::isnan(Converter().convert(Value(1000, Eur), Usd).number()));
+    QVERIFY(Currency::readRateCache(table));
+    QBENCHMARK {
+        Currency::readRateCache(table);
+    }
+}
+
+void ConverterBenchmark::benchmarkCurrencyTable()
+{
+    const QString table = QStringLiteral(":/currency.xml");
+    QVERIFY(QFile::exists(table));
+    QBENCHMARK {
+        Currency::readConversionTable(table);
+    }
+}
+
+QTEST_MAIN(ConverterBenchmark)
+
+#include "moc_converterbenchmark.cpp"
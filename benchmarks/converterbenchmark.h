@@ -0,0 +1,57 @@
+/*
+ *   SPDX-FileCopyrightText: 2026 KUnitConversion Authors
+ *
+ *   SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#ifndef CONVERTERBENCHMARK_H
+#define CONVERTERBENCHMARK_H
+
+#include <QObject>
+#include <QTest>
+
+class ConverterBenchmark : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void initTestCase();
+    void benchmarkConverter();
+    void benchmarkEnumerateUnits_data();
+    void benchmarkEnumerateUnits();
+    void benchmarkUnitByName_data();
+    void benchmarkUnitByName();
+    void benchmarkUnitById();
+    void benchmarkUnitNamesStartingWith();
+    void benchmarkSimilarUnitNames_data();
+    void benchmarkSimilarUnitNames();
+    void benchmarkValueById();
+    void benchmarkValueByName();
+    void benchmarkConvert_data();
+    void benchmarkConvert();
+    void benchmarkConvertQuantity_data();
+    void benchmarkConvertQuantity();
+    void benchmarkConvertTypedQuantity();
+    void benchmarkConvertBatch_data();
+    void benchmarkConvertBatch();
+    void benchmarkConvertMixedUnits_data();
+    void benchmarkConvertMixedUnits();
+    void benchmarkConvertThreads_data();
+    void benchmarkConvertThreads();
+    void benchmarkConvertConstexpr();
+    void benchmarkConvertToAll_data();
+    void benchmarkConvertToAll();
+    void benchmarkToBestUnit();
+    void benchmarkToBestUnits();
+    void benchmarkParse_data();
+    void benchmarkParse();
+    void benchmarkParseSplit_data();
+    void benchmarkParseSplit();
+    void benchmarkToString();
+    void benchmarkToSymbolString();
+    void benchmarkAppendSymbolString();
+    void benchmarkAppendShortestSymbolString();
+    void benchmarkCurrencyRateCache();
+    void benchmarkCurrencyTable();
+};
+
+#endif // CONVERTERBENCHMARK_H
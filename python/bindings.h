@@ -3,7 +3,10 @@
 
 #pragma once
 
+#include <KUnitConversion/ColumnConverter>
+#include <KUnitConversion/ConversionPlan>
 #include <KUnitConversion/Converter>
+#include <KUnitConversion/Quantity>
 #include <KUnitConversion/Unit>
 #include <KUnitConversion/UnitCategory>
 #include <KUnitConversion/Value>
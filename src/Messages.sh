@@ -1,2 +1,2 @@
 #! /usr/bin/env bash
-$XGETTEXT *.cpp -o $podir/kunitconversion6.pot
+$XGETTEXT *.cpp ../tools/*.cpp -o $podir/kunitconversion6.pot
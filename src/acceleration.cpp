@@ -20,7 +20,6 @@ UnitCategory Acceleration::makeCategory()
 
     d->addDefaultUnit(UnitPrivate::makeUnit(AccelerationCategory,
                               MetresPerSecondSquared,
-                              1,
                               i18nc("acceleration unit symbol", "m/s²"),
                               i18nc("unit description in lists", "meters per second squared"),
                               i18nc("unit synonyms for matching user input", "meter per second squared;meters per second squared;m/s²;m/s2;m/s^2"),
@@ -30,7 +29,6 @@ UnitCategory Acceleration::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(AccelerationCategory,
                              FeetPerSecondSquared,
-                             0.3048,
                              i18nc("acceleration unit symbol", "ft/s²"),
                              i18nc("unit description in lists", "feet per second squared"),
                              i18nc("unit synonyms for matching user input", "foot per second squared;feet per second squared;ft/s²;ft/s2;ft/s^2"),
@@ -40,7 +38,6 @@ UnitCategory Acceleration::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(AccelerationCategory,
                        StandardGravity,
-                       9.80665,
                        i18nc("acceleration unit symbol", "g"),
                        i18nc("unit description in lists", "standard gravity"),
                        i18nc("unit synonyms for matching user input", "standard gravity;g"),
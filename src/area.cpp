@@ -24,7 +24,6 @@ UnitCategory Area::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(AreaCategory,
                        SquareYottameter,
-                       1e+48,
                        // i18n: Used when unit symbol is needed.
                        i18nc("area unit symbol", "Ym²"),
                        // i18n: unit as it will be shown to user wherever units are to
@@ -48,7 +47,6 @@ UnitCategory Area::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(AreaCategory,
                        SquareZettameter,
-                       1e+42,
                        i18nc("area unit symbol", "Zm²"),
                        i18nc("unit description in lists", "square zettameters"),
                        i18nc("unit synonyms for matching user input", "square zettameter;square zettameters;Zm²;Zm/-2;Zm^2;Zm2"),
@@ -58,7 +56,6 @@ UnitCategory Area::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(AreaCategory,
                        SquareExameter,
-                       1e+36,
                        i18nc("area unit symbol", "Em²"),
                        i18nc("unit description in lists", "square exameters"),
                        i18nc("unit synonyms for matching user input", "square exameter;square exameters;Em²;Em/-2;Em^2;Em2"),
@@ -68,7 +65,6 @@ UnitCategory Area::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(AreaCategory,
                        SquarePetameter,
-                       1e+30,
                        i18nc("area unit symbol", "Pm²"),
                        i18nc("unit description in lists", "square petameters"),
                        i18nc("unit synonyms for matching user input", "square petameter;square petameters;Pm²;Pm/-2;Pm^2;Pm2"),
@@ -78,7 +74,6 @@ UnitCategory Area::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(AreaCategory,
                        SquareTerameter,
-                       1e+24,
                        i18nc("area unit symbol", "Tm²"),
                        i18nc("unit description in lists", "square terameters"),
                        i18nc("unit synonyms for matching user input", "square terameter;square terameters;Tm²;Tm/-2;Tm^2;Tm2"),
@@ -88,7 +83,6 @@ UnitCategory Area::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(AreaCategory,
                        SquareGigameter,
-                       1e+18,
                        i18nc("area unit symbol", "Gm²"),
                        i18nc("unit description in lists", "square gigameters"),
                        i18nc("unit synonyms for matching user input", "square gigameter;square gigameters;Gm²;Gm/-2;Gm^2;Gm2"),
@@ -98,7 +92,6 @@ UnitCategory Area::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(AreaCategory,
                        SquareMegameter,
-                       1e+12,
                        i18nc("area unit symbol", "Mm²"),
                        i18nc("unit description in lists", "square megameters"),
                        i18nc("unit synonyms for matching user input", "square megameter;square megameters;Mm²;Mm/-2;Mm^2;Mm2"),
@@ -108,7 +101,6 @@ UnitCategory Area::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(AreaCategory,
                              SquareKilometer,
-                             1e+06,
                              i18nc("area unit symbol", "km²"),
                              i18nc("unit description in lists", "square kilometers"),
                              i18nc("unit synonyms for matching user input", "square kilometer;square kilometers;sq km;km²;km/-2;km^2;km2"),
@@ -118,7 +110,6 @@ UnitCategory Area::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(AreaCategory,
                              SquareHectometer,
-                             10000,
                              i18nc("area unit symbol", "hm²"),
                              i18nc("unit description in lists", "square hectometers"),
                              i18nc("unit synonyms for matching user input", "square hectometer;square hectometers;hm²;hm/-2;hm^2;hm2;hectare;hectares"),
@@ -128,7 +119,6 @@ UnitCategory Area::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(AreaCategory,
                        SquareDecameter,
-                       100,
                        i18nc("area unit symbol", "dam²"),
                        i18nc("unit description in lists", "square decameters"),
                        i18nc("unit synonyms for matching user input", "square decameter;square decameters;dam²;dam/-2;dam^2;dam2"),
@@ -138,7 +128,6 @@ UnitCategory Area::makeCategory()
 
     d->addDefaultUnit(UnitPrivate::makeUnit(AreaCategory,
                               SquareMeter,
-                              1,
                               i18nc("area unit symbol", "m²"),
                               i18nc("unit description in lists", "square meters"),
                               i18nc("unit synonyms for matching user input", "square meter;square meters;sq m;m²;m/-2;m^2;m2"),
@@ -148,7 +137,6 @@ UnitCategory Area::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(AreaCategory,
                        SquareDecimeter,
-                       0.01,
                        i18nc("area unit symbol", "dm²"),
                        i18nc("unit description in lists", "square decimeters"),
                        i18nc("unit synonyms for matching user input", "square decimeter;square decimeters;dm²;dm/-2;dm^2;dm2"),
@@ -158,7 +146,6 @@ UnitCategory Area::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(AreaCategory,
                        SquareCentimeter,
-                       0.0001,
                        i18nc("area unit symbol", "cm²"),
                        i18nc("unit description in lists", "square centimeters"),
                        i18nc("unit synonyms for matching user input", "square centimeter;square centimeters;sq cm;cm²;cm/-2;cm^2;cm2"),
@@ -168,7 +155,6 @@ UnitCategory Area::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(AreaCategory,
                        SquareMillimeter,
-                       1e-06,
                        i18nc("area unit symbol", "mm²"),
                        i18nc("unit description in lists", "square millimeters"),
                        i18nc("unit synonyms for matching user input", "square millimeter;square millimeters;sq mm;mm²;mm/-2;mm^2;mm2"),
@@ -178,7 +164,6 @@ UnitCategory Area::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(AreaCategory,
                        SquareMicrometer,
-                       1e-12,
                        i18nc("area unit symbol", "µm²"),
                        i18nc("unit description in lists", "square micrometers"),
                        i18nc("unit synonyms for matching user input", "square micrometer;square micrometers;µm²;um²;µm/-2;µm^2;µm2"),
@@ -188,7 +173,6 @@ UnitCategory Area::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(AreaCategory,
                        SquareNanometer,
-                       1e-18,
                        i18nc("area unit symbol", "nm²"),
                        i18nc("unit description in lists", "square nanometers"),
                        i18nc("unit synonyms for matching user input", "square nanometer;square nanometers;nm²;nm/-2;nm^2;nm2"),
@@ -198,7 +182,6 @@ UnitCategory Area::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(AreaCategory,
                        SquarePicometer,
-                       1e-24,
                        i18nc("area unit symbol", "pm²"),
                        i18nc("unit description in lists", "square picometers"),
                        i18nc("unit synonyms for matching user input", "square picometer;square picometers;pm²;pm/-2;pm^2;pm2"),
@@ -208,7 +191,6 @@ UnitCategory Area::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(AreaCategory,
                        SquareFemtometer,
-                       1e-30,
                        i18nc("area unit symbol", "fm²"),
                        i18nc("unit description in lists", "square femtometers"),
                        i18nc("unit synonyms for matching user input", "square femtometer;square femtometers;fm²;fm/-2;fm^2;fm2"),
@@ -218,7 +200,6 @@ UnitCategory Area::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(AreaCategory,
                        SquareAttometer,
-                       1e-36,
                        i18nc("area unit symbol", "am²"),
                        i18nc("unit description in lists", "square attometers"),
                        i18nc("unit synonyms for matching user input", "square attometer;square attometers;am²;am/-2;am^2;am2"),
@@ -228,7 +209,6 @@ UnitCategory Area::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(AreaCategory,
                        SquareZeptometer,
-                       1e-42,
                        i18nc("area unit symbol", "zm²"),
                        i18nc("unit description in lists", "square zeptometers"),
                        i18nc("unit synonyms for matching user input", "square zeptometer;square zeptometers;zm²;zm/-2;zm^2;zm2"),
@@ -238,7 +218,6 @@ UnitCategory Area::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(AreaCategory,
                        SquareYoctometer,
-                       1e-48,
                        i18nc("area unit symbol", "ym²"),
                        i18nc("unit description in lists", "square yoctometers"),
                        i18nc("unit synonyms for matching user input", "square yoctometer;square yoctometers;ym²;ym/-2;ym^2;ym2"),
@@ -248,7 +227,6 @@ UnitCategory Area::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(AreaCategory,
                              Acre,
-                             4046.86,
                              i18nc("area unit symbol", "acre"),
                              i18nc("unit description in lists", "acres"),
                              i18nc("unit synonyms for matching user input", "acre;acres"),
@@ -258,7 +236,6 @@ UnitCategory Area::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(AreaCategory,
                              SquareFoot,
-                             0.092903,
                              i18nc("area unit symbol", "ft²"),
                              i18nc("unit description in lists", "square feet"),
                              i18nc("unit synonyms for matching user input", "square foot;square feet;ft²;square ft;sq foot;sq ft;sq feet;feet²"),
@@ -268,7 +245,6 @@ UnitCategory Area::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(AreaCategory,
                        SquareInch,
-                       0.00064516,
                        i18nc("area unit symbol", "in²"),
                        i18nc("unit description in lists", "square inches"),
                        i18nc("unit synonyms for matching user input", "square inch;square inches;in²;square inch;square in;sq inches;sq inch;sq in;inch²"),
@@ -278,7 +254,6 @@ UnitCategory Area::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(AreaCategory,
                              SquareMile,
-                             2.58999e+06,
                              i18nc("area unit symbol", "mi²"),
                              i18nc("unit description in lists", "square miles"),
                              i18nc("unit synonyms for matching user input", "square mile;square miles;mi²;square mi;sq miles;sq mile;sq mi;mile²"),
@@ -0,0 +1,284 @@
+/*
+ *   SPDX-FileCopyrightText: 2026 KUnitConversion Authors
+ *
+ *   SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#include "columnconverter.h"
+
+#include <QByteArray>
+#include <QIODevice>
+#include <QList>
+
+#include <charconv>
+#include <cstring>
+
+namespace KUnitConversion
+{
+// bytes read from the input at once
+static constexpr qsizetype ChunkSize = 64 * 1024;
+// digits after the decimal point accepted by setPrecision()
+static constexpr int MaxPrecision = 64;
+// fits the fixed notation of the largest double with MaxPrecision digits
+static constexpr int NumberBufferSize = 512;
+
+class ColumnConverterPrivate
+{
+public:
+    ColumnConverterPrivate(const ConversionPlan &plan, int column)
+        : m_plan(plan)
+        , m_column(column)
+    {
+    }
+
+    /**
+     * Converts the complete lines in @p data and appends them to @p out.
+     */
+    void convertLines(const char *data, qsizetype size, QByteArray &out);
+
+    /**
+     * Locates the configured column in the line [@p begin, @p end) and parses it.
+     * @return true if the column holds a number, which is stored in @p number along
+     * with its position relative to the chunk
+     */
+    bool parseColumn(const char *begin, const char *end, qsizetype lineStart, qsizetype &numberStart, qsizetype &numberEnd, qreal &number) const;
+
+    void appendNumber(qreal number, QByteArray &out) const;
+
+    /** A line of the current chunk, offsets are relative to the chunk */
+    struct Line {
+        qsizetype start;
+        qsizetype end; //!< one past the line break
+        qsizetype numberStart; //!< -1 if the line is copied unchanged
+        qsizetype numberEnd;
+    };
+
+    ConversionPlan m_plan;
+    int m_column;
+    char m_delimiter = ',';
+    int m_headerLineCount = 0;
+    int m_precision = -1;
+
+    int m_remainingHeaderLines = 0;
+    qint64 m_convertedCount = 0;
+    qint64 m_skippedCount = 0;
+
+    // reused between chunks to avoid allocations
+    QList<Line> m_lines;
+    QList<qreal> m_numbers;
+};
+
+static const char *skipField(const char *pos, const char *end, char delimiter)
+{
+    if (pos != end && *pos == '"') {
+        // a doubled quote inside a quoted field is an escaped quote
+        ++pos;
+        while (pos != end) {
+            if (*pos++ == '"') {
+                if (pos == end || *pos != '"') {
+                    break;
+                }
+                ++pos;
+            }
+        }
+    }
+    const void *next = std::memchr(pos, delimiter, end - pos);
+    return next ? static_cast<const char *>(next) : end;
+}
+
+static bool isBlank(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+bool ColumnConverterPrivate::parseColumn(const char *begin,
+                                         const char *end,
+                                         qsizetype lineStart,
+                                         qsizetype &numberStart,
+                                         qsizetype &numberEnd,
+                                         qreal &number) const
+{
+    const char *field = begin;
+    for (int i = 0; i < m_column; ++i) {
+        field = skipField(field, end, m_delimiter);
+        if (field == end) {
+            return false;
+        }
+        ++field;
+    }
+    const char *fieldEnd = skipField(field, end, m_delimiter);
+
+    while (field != fieldEnd && isBlank(*field)) {
+        ++field;
+    }
+    while (fieldEnd != field && isBlank(fieldEnd[-1])) {
+        --fieldEnd;
+    }
+    // std::from_chars rejects an explicit plus sign
+    const char *parseStart = field != fieldEnd && *field == '+' ? field + 1 : field;
+    if (parseStart == fieldEnd) {
+        return false;
+    }
+
+    const auto result = std::from_chars(parseStart, fieldEnd, number);
+    if (result.ec != std::errc() || result.ptr != fieldEnd) {
+        return false;
+    }
+    numberStart = lineStart + (field - begin);
+    numberEnd = lineStart + (fieldEnd - begin);
+    return true;
+}
+
+void ColumnConverterPrivate::appendNumber(qreal number, QByteArray &out) const
+{
+    char buffer[NumberBufferSize];
+    const auto result = m_precision < 0 ? std::to_chars(buffer, buffer + sizeof(buffer), number)
+                                        : std::to_chars(buffer, buffer + sizeof(buffer), number, std::chars_format::fixed, m_precision);
+    out.append(buffer, result.ptr - buffer);
+}
+
+void ColumnConverterPrivate::convertLines(const char *data, qsizetype size, QByteArray &out)
+{
+    m_lines.clear();
+    m_numbers.clear();
+
+    // parse all lines first so the whole chunk is converted as one range
+    qsizetype pos = 0;
+    while (pos < size) {
+        const void *lineBreak = std::memchr(data + pos, '\n', size - pos);
+        const qsizetype contentEnd = lineBreak ? static_cast<const char *>(lineBreak) - data : size;
+        Line line{pos, lineBreak ? contentEnd + 1 : size, -1, -1};
+
+        if (m_remainingHeaderLines > 0) {
+            --m_remainingHeaderLines;
+        } else {
+            qreal number;
+            if (parseColumn(data + pos, data + contentEnd, pos, line.numberStart, line.numberEnd, number)) {
+                m_numbers.append(number);
+            } else {
+                ++m_skippedCount;
+            }
+        }
+        m_lines.append(line);
+        pos = line.end;
+    }
+
+    m_plan.convert(QSpan<qreal>(m_numbers));
+    m_convertedCount += m_numbers.size();
+
+    out.clear();
+    out.reserve(size + m_numbers.size() * 8);
+    qsizetype number = 0;
+    for (const Line &line : std::as_const(m_lines)) {
+        if (line.numberStart < 0) {
+            out.append(data + line.start, line.end - line.start);
+            continue;
+        }
+        out.append(data + line.start, line.numberStart - line.start);
+        appendNumber(m_numbers.at(number++), out);
+        out.append(data + line.numberEnd, line.end - line.numberEnd);
+    }
+}
+
+ColumnConverter::ColumnConverter(const ConversionPlan &plan, int column)
+    : d(new ColumnConverterPrivate(plan, column))
+{
+}
+
+ColumnConverter::~ColumnConverter() = default;
+
+ConversionPlan ColumnConverter::conversionPlan() const
+{
+    return d->m_plan;
+}
+
+int ColumnConverter::column() const
+{
+    return d->m_column;
+}
+
+char ColumnConverter::delimiter() const
+{
+    return d->m_delimiter;
+}
+
+void ColumnConverter::setDelimiter(char delimiter)
+{
+    d->m_delimiter = delimiter;
+}
+
+int ColumnConverter::headerLineCount() const
+{
+    return d->m_headerLineCount;
+}
+
+void ColumnConverter::setHeaderLineCount(int count)
+{
+    d->m_headerLineCount = qMax(0, count);
+}
+
+int ColumnConverter::precision() const
+{
+    return d->m_precision;
+}
+
+void ColumnConverter::setPrecision(int precision)
+{
+    d->m_precision = qBound(-1, precision, MaxPrecision);
+}
+
+bool ColumnConverter::convert(QIODevice *input, QIODevice *output)
+{
+    d->m_remainingHeaderLines = d->m_headerLineCount;
+    d->m_convertedCount = 0;
+    d->m_skippedCount = 0;
+
+    if (!d->m_plan.isValid() || d->m_column < 0 || !input || !output) {
+        return false;
+    }
+
+    QByteArray buffer;
+    QByteArray out;
+    // bytes of an incomplete line left over from the previous chunk
+    qsizetype carry = 0;
+    for (;;) {
+        buffer.resize(carry + ChunkSize);
+        const qint64 bytesRead = input->read(buffer.data() + carry, ChunkSize);
+        if (bytesRead < 0) {
+            return false;
+        }
+        const qsizetype available = carry + bytesRead;
+        const bool atEnd = bytesRead == 0;
+
+        qsizetype end = available;
+        if (!atEnd) {
+            end = buffer.lastIndexOf('\n', available - 1) + 1;
+        }
+        if (end > 0) {
+            d->convertLines(buffer.constData(), end, out);
+            if (output->write(out) != out.size()) {
+                return false;
+            }
+        }
+        if (atEnd) {
+            return true;
+        }
+
+        carry = available - end;
+        if (carry > 0 && end > 0) {
+            std::memmove(buffer.data(), buffer.constData() + end, carry);
+        }
+    }
+}
+
+qint64 ColumnConverter::convertedCount() const
+{
+    return d->m_convertedCount;
+}
+
+qint64 ColumnConverter::skippedCount() const
+{
+    return d->m_skippedCount;
+}
+
+} // KUnitConversion namespace
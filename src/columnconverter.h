@@ -0,0 +1,141 @@
+/*
+ *   SPDX-FileCopyrightText: 2026 KUnitConversion Authors
+ *
+ *   SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#ifndef KUNITCONVERSION_COLUMNCONVERTER_H
+#define KUNITCONVERSION_COLUMNCONVERTER_H
+
+#include "kunitconversion/kunitconversion_export.h"
+
+#include "conversionplan.h"
+
+#include <memory>
+
+class QIODevice;
+
+namespace KUnitConversion
+{
+class ColumnConverterPrivate;
+
+/*!
+ * \class KUnitConversion::ColumnConverter
+ * \inmodule KUnitConversion
+ *
+ * \brief Converts one numeric column of a delimited text stream.
+ *
+ * The column converter reads comma or tab separated text from a device in
+ * fixed-size chunks, converts the numbers found in one column with a
+ * ConversionPlan and writes every line to another device, keeping all other
+ * columns byte for byte. Memory use is bounded by the chunk size plus the
+ * longest line, so arbitrarily large files can be processed.
+ *
+ * Input is treated as UTF-8 or any other ASCII compatible encoding. Numbers
+ * must use a dot as decimal separator and may use an exponent, as in
+ * \c 1.5e3. Fields may be quoted, but quoted fields must not contain line
+ * breaks. Cells of the converted column that do not hold a number are
+ * written unchanged.
+ *
+ * \code
+ * QFile input(QStringLiteral("distances.csv"));
+ * QFile output(QStringLiteral("distances-km.csv"));
+ * input.open(QIODevice::ReadOnly);
+ * output.open(QIODevice::WriteOnly);
+ *
+ * Converter units;
+ * ColumnConverter converter(units.conversionPlan(Mile, Kilometer), 2);
+ * converter.setHeaderLineCount(1);
+ * converter.convert(&input, &output);
+ * \endcode
+ *
+ * \sa ConversionPlan
+ * \since 6.28
+ */
+class KUNITCONVERSION_EXPORT ColumnConverter
+{
+public:
+    /*!
+     * Creates a converter that converts the numbers in the zero-based
+     * \a column with \a plan.
+     */
+    ColumnConverter(const ConversionPlan &plan, int column);
+
+    ~ColumnConverter();
+
+    /*!
+     * Returns the conversion applied to the column.
+     **/
+    ConversionPlan conversionPlan() const;
+
+    /*!
+     * Returns the zero-based index of the converted column.
+     **/
+    int column() const;
+
+    /*!
+     * Returns the character separating fields, a comma by default.
+     **/
+    char delimiter() const;
+
+    /*!
+     * Sets the character separating fields to \a delimiter, e.g. \c '\\t' for
+     * tab separated values.
+     **/
+    void setDelimiter(char delimiter);
+
+    /*!
+     * Returns the number of lines at the start of the stream that are copied
+     * without conversion, 0 by default.
+     **/
+    int headerLineCount() const;
+
+    /*!
+     * Copies the first \a count lines of the stream without conversion.
+     **/
+    void setHeaderLineCount(int count);
+
+    /*!
+     * Returns the number of digits written after the decimal point, or -1
+     * if converted numbers are written in the shortest form that reads back
+     * to the same value. -1 is the default.
+     **/
+    int precision() const;
+
+    /*!
+     * Writes converted numbers with \a precision digits after the decimal
+     * point. -1 selects the shortest form that reads back to the same value.
+     **/
+    void setPrecision(int precision);
+
+    /*!
+     * Reads lines from \a input until it is exhausted and writes them to
+     * \a output with the numbers in the column converted. Reading stops at
+     * the first read that returns no data, so sequential devices other than
+     * files and standard input must have received all data beforehand.
+     *
+     * Returns \c false if the conversion plan is invalid or if reading or
+     * writing fails, \c true otherwise.
+     **/
+    bool convert(QIODevice *input, QIODevice *output);
+
+    /*!
+     * Returns the number of cells converted by the last call to convert().
+     **/
+    qint64 convertedCount() const;
+
+    /*!
+     * Returns the number of lines in the last call to convert() that were
+     * copied unchanged because the column was missing or not a number.
+     * Header lines are not counted.
+     **/
+    qint64 skippedCount() const;
+
+private:
+    Q_DISABLE_COPY(ColumnConverter)
+    std::unique_ptr<ColumnConverterPrivate> const d;
+};
+
+} // KUnitConversion namespace
+
+#endif
@@ -0,0 +1,202 @@
+/*
+ *   SPDX-FileCopyrightText: 2026 KUnitConversion Authors
+ *
+ *   SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#include "conversionplan.h"
+#include "conversionplan_p.h"
+#include "simdkernels_p.h"
+#include "unit_p.h"
+#include "unitcategory_p.h"
+
+#include <algorithm>
+
+namespace KUnitConversion
+{
+ConversionKernel::ConversionKernel(const UnitPrivate *from, const UnitPrivate *to)
+    : m_from(from)
+    , m_to(to)
+{
+    if (!from || !to || from->m_categoryId != to->m_categoryId) {
+        return;
+    }
+
+    // fold to->fromDefault(from->toDefault(x)) into a single operation where possible,
+    // with the constants computed in extended precision before rounding them to qreal
+    using Extended = long double;
+    const UnitTransform f = from->transform();
+    const UnitTransform t = to->transform();
+    if (f.kind == UnitTransform::Linear && t.kind == UnitTransform::Linear) {
+        // (f.scale * x + f.offset - t.offset) / t.scale, also covers powers of two
+        m_a = qreal(Extended(f.scale) / t.scale);
+        m_b = qreal((Extended(f.offset) - t.offset) / t.scale);
+        m_kind = m_b == 0.0 ? Scale : Affine;
+    } else if (f.kind == UnitTransform::Reciprocal && t.kind == UnitTransform::Reciprocal) {
+        // t.scale / (f.scale / x)
+        m_a = qreal(Extended(t.scale) / f.scale);
+        m_kind = Scale;
+    } else if (f.kind == UnitTransform::Reciprocal && t.kind == UnitTransform::Linear && t.offset == 0.0) {
+        // (f.scale / x) / t.scale
+        m_a = qreal(Extended(f.scale) / t.scale);
+        m_kind = Reciprocal;
+    } else if (f.kind == UnitTransform::Linear && f.offset == 0.0 && t.kind == UnitTransform::Reciprocal) {
+        // t.scale / (f.scale * x)
+        m_a = qreal(Extended(t.scale) / f.scale);
+        m_kind = Reciprocal;
+    } else {
+        m_kind = Generic;
+    }
+}
+
+qreal ConversionKernel::applyGeneric(qreal value) const
+{
+    return m_to->fromDefault(m_from->toDefault(value));
+}
+
+void ConversionKernel::apply(QSpan<const qreal> input, QSpan<qreal> output) const
+{
+    const qsizetype size = input.size();
+    const qreal *in = input.data();
+    qreal *out = output.data();
+    const qreal a = m_a;
+
+    switch (m_kind) {
+    case Scale:
+        Simd::scale(Simd::supportedLevel(), in, out, size, a);
+        break;
+    case Affine:
+        Simd::affine(Simd::supportedLevel(), in, out, size, a, m_b);
+        break;
+    case Reciprocal:
+        for (qsizetype i = 0; i < size; ++i) {
+            out[i] = a / in[i];
+        }
+        break;
+    case Generic:
+        for (qsizetype i = 0; i < size; ++i) {
+            out[i] = m_to->fromDefault(m_from->toDefault(in[i]));
+        }
+        break;
+    case Invalid:
+        std::fill_n(out, size, qQNaN());
+        break;
+    }
+}
+
+void ConversionKernel::apply(QSpan<const float> input, QSpan<float> output) const
+{
+    // float values are converted in double precision and rounded once
+    const qsizetype size = input.size();
+    const float *in = input.data();
+    float *out = output.data();
+
+    switch (m_kind) {
+    case Scale:
+        Simd::scale(Simd::supportedLevel(), in, out, size, m_a);
+        break;
+    case Affine:
+        Simd::affine(Simd::supportedLevel(), in, out, size, m_a, m_b);
+        break;
+    case Reciprocal:
+    case Generic:
+    case Invalid:
+        for (qsizetype i = 0; i < size; ++i) {
+            out[i] = float(apply(qreal(in[i])));
+        }
+        break;
+    }
+}
+
+ConversionPlan::ConversionPlan()
+    : d(nullptr)
+{
+}
+
+ConversionPlan::ConversionPlan(const Unit &fromUnit, const Unit &toUnit)
+    : d(new ConversionPlanPrivate)
+{
+    d->m_fromUnit = fromUnit;
+    d->m_toUnit = toUnit;
+    d->m_kernel = UnitCategoryPrivate::kernelFor(fromUnit, toUnit);
+}
+
+ConversionPlan::ConversionPlan(const ConversionPlan &other)
+    : d(other.d)
+{
+}
+
+ConversionPlan::~ConversionPlan()
+{
+}
+
+ConversionPlan &ConversionPlan::operator=(const ConversionPlan &other)
+{
+    d = other.d;
+    return *this;
+}
+
+ConversionPlan &ConversionPlan::operator=(ConversionPlan &&other)
+{
+    d.swap(other.d);
+    return *this;
+}
+
+bool ConversionPlan::isValid() const
+{
+    return d && d->m_kernel.m_kind != ConversionKernel::Invalid;
+}
+
+Unit ConversionPlan::fromUnit() const
+{
+    if (d) {
+        return d->m_fromUnit;
+    }
+    return Unit();
+}
+
+Unit ConversionPlan::toUnit() const
+{
+    if (d) {
+        return d->m_toUnit;
+    }
+    return Unit();
+}
+
+qreal ConversionPlan::convert(qreal value) const
+{
+    if (d) {
+        return d->m_kernel.apply(value);
+    }
+    return qQNaN();
+}
+
+bool ConversionPlan::convert(QSpan<const qreal> input, QSpan<qreal> output) const
+{
+    if (!isValid() || output.size() < input.size()) {
+        return false;
+    }
+    d->m_kernel.apply(input, output);
+    return true;
+}
+
+bool ConversionPlan::convert(QSpan<qreal> numbers) const
+{
+    return convert(numbers, numbers);
+}
+
+bool ConversionPlan::convert(QSpan<const float> input, QSpan<float> output) const
+{
+    if (!isValid() || output.size() < input.size()) {
+        return false;
+    }
+    d->m_kernel.apply(input, output);
+    return true;
+}
+
+bool ConversionPlan::convert(QSpan<float> numbers) const
+{
+    return convert(numbers, numbers);
+}
+
+}
@@ -0,0 +1,145 @@
+/*
+ *   SPDX-FileCopyrightText: 2026 KUnitConversion Authors
+ *
+ *   SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#ifndef KUNITCONVERSION_CONVERSIONPLAN_H
+#define KUNITCONVERSION_CONVERSIONPLAN_H
+
+#include "kunitconversion/kunitconversion_export.h"
+
+#include "unit.h"
+
+#include <QExplicitlySharedDataPointer>
+#include <QSpan>
+
+namespace KUnitConversion
+{
+class ConversionPlanPrivate;
+
+/*!
+ * \class KUnitConversion::ConversionPlan
+ * \inmodule KUnitConversion
+ *
+ * \brief Precomputed conversion between two units of measurement.
+ *
+ * A conversion plan resolves a pair of units once and folds the conversion
+ * between them into a single operation where possible, i.e. a scale factor,
+ * an affine mapping (e.g. between temperature scales) or a reciprocal
+ * (e.g. between fuel consumption and fuel efficiency). It can then be applied
+ * to any number of values without further lookups.
+ *
+ * Conversion rates that change at runtime, such as currency exchange rates,
+ * are captured when the plan is created.
+ *
+ * The folded operation rounds differently than Value::convertTo(), which
+ * converts to the default unit of the category first and from there to the
+ * target unit, so results may differ from it in the last bits. The difference
+ * is at most four times \c{std::numeric_limits<qreal>::epsilon()} relative to
+ * the magnitude of the result. For affine conversions, such as between
+ * temperature scales, the magnitude also includes the zero points of the
+ * source unit and of the default unit, both expressed in the target unit.
+ *
+ * Scale and affine conversions of ranges are vectorized with the widest SIMD
+ * instructions supported by the CPU, and yield the same results as converting
+ * the values one by one.
+ *
+ * \sa Converter, Unit
+ * \since 6.28
+ */
+class KUNITCONVERSION_EXPORT ConversionPlan
+{
+public:
+    /*!
+     * Creates an invalid conversion plan.
+     */
+    ConversionPlan();
+
+    /*!
+     * Creates a conversion plan from \a fromUnit to \a toUnit.
+     *
+     * The plan is invalid if one of the units is invalid or if they belong to
+     * different categories.
+     */
+    ConversionPlan(const Unit &fromUnit, const Unit &toUnit);
+
+    ConversionPlan(const ConversionPlan &other);
+
+    ~ConversionPlan();
+
+    ConversionPlan &operator=(const ConversionPlan &other);
+
+    ConversionPlan &operator=(ConversionPlan &&other);
+
+    /*!
+     * Returns true if the plan can convert values.
+     **/
+    bool isValid() const;
+
+    /*!
+     * Returns the unit values are converted from.
+     **/
+    Unit fromUnit() const;
+
+    /*!
+     * Returns the unit values are converted to.
+     **/
+    Unit toUnit() const;
+
+    /*!
+     * Convert \a value.
+     *
+     * Returns the converted value, or NaN if the plan is invalid.
+     **/
+    qreal convert(qreal value) const;
+
+    /*!
+     * \overload ConversionPlan::convert()
+     *
+     * Convert a range of numbers.
+     *
+     * \a input numbers to convert
+     *
+     * \a output receives the converted numbers, must be at least as large as \a input.
+     * May be the same range as \a input.
+     *
+     * Returns \c false if the plan is invalid or if \a output is too small, \c true otherwise.
+     **/
+    bool convert(QSpan<const qreal> input, QSpan<qreal> output) const;
+
+    /*!
+     * \overload ConversionPlan::convert()
+     *
+     * Convert a range of numbers in place.
+     **/
+    bool convert(QSpan<qreal> numbers) const;
+
+    /*!
+     * \overload ConversionPlan::convert()
+     *
+     * Convert a range of single precision numbers. The conversion is computed
+     * in double precision and rounded once to single precision.
+     *
+     * \since 6.28
+     **/
+    bool convert(QSpan<const float> input, QSpan<float> output) const;
+
+    /*!
+     * \overload ConversionPlan::convert()
+     *
+     * Convert a range of single precision numbers in place.
+     *
+     * \since 6.28
+     **/
+    bool convert(QSpan<float> numbers) const;
+
+private:
+    QExplicitlySharedDataPointer<ConversionPlanPrivate> d;
+};
+
+} // KUnitConversion namespace
+
+Q_DECLARE_TYPEINFO(KUnitConversion::ConversionPlan, Q_RELOCATABLE_TYPE);
+
+#endif
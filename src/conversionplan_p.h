@@ -0,0 +1,81 @@
+/*
+ *   SPDX-FileCopyrightText: 2026 KUnitConversion Authors
+ *
+ *   SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#ifndef KUNITCONVERSION_CONVERSIONPLAN_P_H
+#define KUNITCONVERSION_CONVERSIONPLAN_P_H
+
+#include "conversionplan.h"
+
+#include <QSpan>
+#include <qnumeric.h>
+
+namespace KUnitConversion
+{
+class UnitPrivate;
+
+/**
+ * Conversion between two units of the same category, folded into a single
+ * operation where the transforms of the units allow it.
+ */
+class ConversionKernel
+{
+public:
+    enum Kind {
+        Invalid, //!< units cannot be converted into each other, yields NaN
+        Scale, //!< y = a * x
+        Affine, //!< y = a * x + b
+        Reciprocal, //!< y = a / x
+        Generic, //!< y = to->fromDefault(from->toDefault(x))
+    };
+
+    ConversionKernel() = default;
+    ConversionKernel(const UnitPrivate *from, const UnitPrivate *to);
+
+    /**
+     * Converts a single @p value. Inline, so every translation unit calling it must be
+     * compiled without floating point contraction to round like the vectorized kernels.
+     */
+    inline qreal apply(qreal value) const
+    {
+        switch (m_kind) {
+        case Scale:
+            return m_a * value;
+        case Affine:
+            return m_a * value + m_b;
+        case Reciprocal:
+            return m_a / value;
+        case Generic:
+            return applyGeneric(value);
+        case Invalid:
+            break;
+        }
+        return qQNaN();
+    }
+
+    void apply(QSpan<const qreal> input, QSpan<qreal> output) const;
+    void apply(QSpan<const float> input, QSpan<float> output) const;
+
+    Kind m_kind = Invalid;
+    qreal m_a = 0.0;
+    qreal m_b = 0.0;
+    const UnitPrivate *m_from = nullptr;
+    const UnitPrivate *m_to = nullptr;
+
+private:
+    qreal applyGeneric(qreal value) const;
+};
+
+class ConversionPlanPrivate : public QSharedData
+{
+public:
+    Unit m_fromUnit;
+    Unit m_toUnit;
+    ConversionKernel m_kernel;
+};
+
+} // KUnitConversion namespace
+
+#endif // KUNITCONVERSION_CONVERSIONPLAN_P_H
@@ -6,6 +6,7 @@
  */
 
 #include "converter.h"
+#include "converter_p.h"
 
 #include "acceleration_p.h"
 #include "angle_p.h"
@@ -30,65 +31,442 @@
 #include "thermal_flux_p.h"
 #include "thermal_generation_p.h"
 #include "timeunit_p.h"
+#include "kunitconversion_debug.h"
+#include "kunitconversion_version.h"
 #include "unit.h"
 #include "velocity_p.h"
 #include "voltage_p.h"
 #include "volume_p.h"
 
 #include <KLocalizedString>
+#include <QDataStream>
+#include <QDir>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QStandardPaths>
 
 namespace KUnitConversion
 {
-class ConverterPrivate : public QSharedData
-{
-public:
-    ConverterPrivate()
-    {
-        m_categories[LengthCategory] = Length::makeCategory();
-        m_categories[AreaCategory] = Area::makeCategory();
-        m_categories[VolumeCategory] = Volume::makeCategory();
-        m_categories[TemperatureCategory] = Temperature::makeCategory();
-        m_categories[VelocityCategory] = Velocity::makeCategory();
-        m_categories[MassCategory] = Mass::makeCategory();
-        m_categories[PressureCategory] = Pressure::makeCategory();
-        m_categories[EnergyCategory] = Energy::makeCategory();
-        m_categories[CurrencyCategory] = Currency::makeCategory();
-        m_categories[PowerCategory] = Power::makeCategory();
-        m_categories[TimeCategory] = Time::makeCategory();
-        m_categories[FuelEfficiencyCategory] = FuelEfficiency::makeCategory();
-        m_categories[DensityCategory] = Density::makeCategory();
-        m_categories[WeightPerAreaCategory] = WeightPerArea::makeCategory();
-        m_categories[AccelerationCategory] = Acceleration::makeCategory();
-        m_categories[ForceCategory] = Force::makeCategory();
-        m_categories[AngleCategory] = Angle::makeCategory();
-        m_categories[FrequencyCategory] = Frequency::makeCategory();
-        m_categories[ThermalConductivityCategory] = ThermalConductivity::makeCategory();
-        m_categories[ThermalFluxCategory] = ThermalFlux::makeCategory();
-        m_categories[ThermalGenerationCategory] = ThermalGeneration::makeCategory();
-        m_categories[VoltageCategory] = Voltage::makeCategory();
-        m_categories[ElectricalCurrentCategory] = ElectricalCurrent::makeCategory();
-        m_categories[ElectricalResistanceCategory] = ElectricalResistance::makeCategory();
-        m_categories[PermeabilityCategory] = Permeability::makeCategory();
-        m_categories[BinaryDataCategory] = BinaryData::makeCategory();
-    }
-
-    QMap<CategoryId, UnitCategory> m_categories;
-};
-
-class QConverterSingleton
-{
-public:
-    QConverterSingleton()
-        : d(new ConverterPrivate())
-    {
-    }
-    QExplicitlySharedDataPointer<ConverterPrivate> d;
-};
-
-Q_GLOBAL_STATIC(QConverterSingleton, global_converter)
+static UnitCategory makeCategory(CategoryId categoryId)
+{
+    switch (categoryId) {
+    case LengthCategory:
+        return Length::makeCategory();
+    case AreaCategory:
+        return Area::makeCategory();
+    case VolumeCategory:
+        return Volume::makeCategory();
+    case TemperatureCategory:
+        return Temperature::makeCategory();
+    case VelocityCategory:
+        return Velocity::makeCategory();
+    case MassCategory:
+        return Mass::makeCategory();
+    case PressureCategory:
+        return Pressure::makeCategory();
+    case EnergyCategory:
+        return Energy::makeCategory();
+    case CurrencyCategory:
+        return Currency::makeCategory();
+    case PowerCategory:
+        return Power::makeCategory();
+    case TimeCategory:
+        return Time::makeCategory();
+    case FuelEfficiencyCategory:
+        return FuelEfficiency::makeCategory();
+    case DensityCategory:
+        return Density::makeCategory();
+    case WeightPerAreaCategory:
+        return WeightPerArea::makeCategory();
+    case AccelerationCategory:
+        return Acceleration::makeCategory();
+    case ForceCategory:
+        return Force::makeCategory();
+    case AngleCategory:
+        return Angle::makeCategory();
+    case FrequencyCategory:
+        return Frequency::makeCategory();
+    case ThermalConductivityCategory:
+        return ThermalConductivity::makeCategory();
+    case ThermalFluxCategory:
+        return ThermalFlux::makeCategory();
+    case ThermalGenerationCategory:
+        return ThermalGeneration::makeCategory();
+    case VoltageCategory:
+        return Voltage::makeCategory();
+    case ElectricalCurrentCategory:
+        return ElectricalCurrent::makeCategory();
+    case ElectricalResistanceCategory:
+        return ElectricalResistance::makeCategory();
+    case PermeabilityCategory:
+        return Permeability::makeCategory();
+    case BinaryDataCategory:
+        return BinaryData::makeCategory();
+    case InvalidCategory:
+        break;
+    }
+    return UnitCategory();
+}
+
+static constexpr quint32 UnitNameCacheMagic = 0x4b554e43; // "KUNC"
+static constexpr quint32 UnitNameCacheVersion = 1;
+
+static QString unitNameCacheLocation(const QStringList &languages)
+{
+    const QString suffix = languages.isEmpty() ? QStringLiteral("C") : languages.join(QLatin1Char('+'));
+    return QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation) + QStringLiteral("/libkunitconversion/unitnames-") + suffix;
+}
+
+/*
+ * The name cache is only valid for the library and the translation catalogs it
+ * was written with, which the key identifies by their version and modification time.
+ */
+static QString unitNameCacheKey(const QStringList &languages)
+{
+    QString key = QStringLiteral(KUNITCONVERSION_VERSION_STRING) + QLatin1Char(';') + QString::fromLatin1(qVersion());
+    for (const QString &language : languages) {
+        const QString catalog =
+            QStandardPaths::locate(QStandardPaths::GenericDataLocation, QStringLiteral("locale/%1/LC_MESSAGES/" TRANSLATION_DOMAIN ".mo").arg(language));
+        key += QLatin1Char(';') + language + QLatin1Char('=');
+        if (!catalog.isEmpty()) {
+            key += QString::number(QFileInfo(catalog).lastModified().toMSecsSinceEpoch());
+        }
+    }
+    return key;
+}
+
+ConverterPrivate::ConverterPrivate()
+{
+}
+
+ConverterPrivate::~ConverterPrivate()
+{
+}
+
+CategoryId ConverterPrivate::categoryForUnitId(UnitId unitId)
+{
+    if (unitId < 0) {
+        return InvalidCategory;
+    }
+    switch (unitId / UnitIdBlockSize) {
+    case SquareYottameter / UnitIdBlockSize:
+        return AreaCategory;
+    case Yottameter / UnitIdBlockSize:
+        return LengthCategory;
+    case CubicYottameter / UnitIdBlockSize:
+        return VolumeCategory;
+    case Yottagram / UnitIdBlockSize:
+        return MassCategory;
+    case Yottapascal / UnitIdBlockSize:
+        return PressureCategory;
+    case Kelvin / UnitIdBlockSize:
+        return TemperatureCategory;
+    case Yottajoule / UnitIdBlockSize:
+        return EnergyCategory;
+    case Eur / UnitIdBlockSize:
+        return CurrencyCategory;
+    case MeterPerSecond / UnitIdBlockSize:
+        return VelocityCategory;
+    case Yottawatt / UnitIdBlockSize:
+        return PowerCategory;
+    case Yottasecond / UnitIdBlockSize:
+        return TimeCategory;
+    case LitersPer100Kilometers / UnitIdBlockSize:
+        return FuelEfficiencyCategory;
+    case YottakilogramsPerCubicMeter / UnitIdBlockSize:
+        // weight per area units follow the density units within the same block
+        return unitId >= GramsPerSquareMeter ? WeightPerAreaCategory : DensityCategory;
+    case MetresPerSecondSquared / UnitIdBlockSize:
+        return AccelerationCategory;
+    case Yottanewton / UnitIdBlockSize:
+        return ForceCategory;
+    case Degree / UnitIdBlockSize:
+        return AngleCategory;
+    case Yottahertz / UnitIdBlockSize:
+        return FrequencyCategory;
+    case WattPerMeterKelvin / UnitIdBlockSize:
+        return ThermalConductivityCategory;
+    case WattPerSquareMeter / UnitIdBlockSize:
+        return ThermalFluxCategory;
+    case WattPerCubicMeter / UnitIdBlockSize:
+        return ThermalGenerationCategory;
+    case Yottavolts / UnitIdBlockSize:
+        return VoltageCategory;
+    case Yottaampere / UnitIdBlockSize:
+        return ElectricalCurrentCategory;
+    case Yottaohms / UnitIdBlockSize:
+        return ElectricalResistanceCategory;
+    case Darcy / UnitIdBlockSize:
+        return PermeabilityCategory;
+    case Yobibyte / UnitIdBlockSize:
+        return BinaryDataCategory;
+    }
+    return InvalidCategory;
+}
+
+void ConverterPrivate::buildCategory(CategoryId categoryId)
+{
+    // called with m_mutex locked
+    if (m_built[categoryId].loadRelaxed()) {
+        return;
+    }
+    m_categories[categoryId] = makeCategory(categoryId);
+    QList<Unit> &unitsById = m_unitsById[categoryId];
+    for (const Unit &unit : std::as_const(UnitCategoryPrivate::get(m_categories[categoryId])->m_units)) {
+        Q_ASSERT(categoryForUnitId(unit.id()) == categoryId);
+        const qsizetype offset = unit.id() % UnitIdBlockSize;
+        if (offset >= unitsById.size()) {
+            unitsById.resize(offset + 1);
+        }
+        unitsById[offset] = unit;
+    }
+    m_built[categoryId].storeRelease(1);
+}
+
+const Unit *ConverterPrivate::unit(const QString &name)
+{
+    const UnitIndex *index = m_unitIndex.loadAcquire();
+    if (index) {
+        const auto it = index->units.constFind(name);
+        if (it != index->units.constEnd()) {
+            return &it.value();
+        }
+        if (index->categoryCount == CategoryCount) {
+            return nullptr;
+        }
+    }
+
+    if (const UnitNameCache *cache = unitNameCache()) {
+        const CategoryId categoryId = cache->categories.value(name, InvalidCategory);
+        if (categoryId == InvalidCategory) {
+            return nullptr;
+        }
+        if (const UnitCategory *unitCategory = category(categoryId)) {
+            const QMap<QString, Unit> &units = UnitCategoryPrivate::get(*unitCategory)->m_unitMap;
+            const auto it = units.constFind(name);
+            if (it != units.constEnd()) {
+                return &it.value();
+            }
+        }
+        // the cache does not match the categories, e.g. after the languages changed
+    }
+
+    for (;;) {
+        index = extendUnitIndex(index);
+        const auto it = index->units.constFind(name);
+        if (it != index->units.constEnd()) {
+            return &it.value();
+        }
+        if (index->categoryCount == CategoryCount) {
+            return nullptr;
+        }
+    }
+}
+
+const Unit *ConverterPrivate::unit(const QString &name, UnitMatchMode mode)
+{
+    const Unit *exact = unit(name);
+    if (exact || mode == ExactMatch) {
+        return exact;
+    }
+
+    const QString key = UnitCategoryPrivate::normalizedName(name);
+    const UnitIndex *index = m_unitIndex.loadAcquire();
+    if (!index || index->categoryCount < CategoryCount) {
+        if (const UnitNameCache *cache = unitNameCache()) {
+            const CategoryId categoryId = cache->normalizedCategories.value(key, InvalidCategory);
+            if (categoryId == InvalidCategory) {
+                return nullptr;
+            }
+            if (const UnitCategory *unitCategory = category(categoryId)) {
+                const QHash<QString, Unit> &units = UnitCategoryPrivate::get(*unitCategory)->m_normalizedUnitMap;
+                const auto it = units.constFind(key);
+                if (it != units.constEnd()) {
+                    return &it.value();
+                }
+            }
+        }
+        index = completeUnitIndex();
+    }
+    const auto it = index->normalizedUnits.constFind(key);
+    return it != index->normalizedUnits.constEnd() ? &it.value() : nullptr;
+}
+
+const ConverterPrivate::UnitIndex *ConverterPrivate::extendUnitIndex(const UnitIndex *index)
+{
+    QMutexLocker locker(&m_mutex);
+    const UnitIndex *current = m_unitIndex.loadRelaxed();
+    if (current != index) {
+        return current; // extended by another thread meanwhile
+    }
+
+    // synonyms shared between categories resolve to the category with the lowest id,
+    // so the index always covers the first categories, doubling their number each time
+    auto next = std::make_unique<UnitIndex>();
+    const int first = index ? index->categoryCount : 0;
+    if (index) {
+        next->units = index->units;
+        next->normalizedUnits = index->normalizedUnits;
+    }
+    next->categoryCount = std::min(CategoryCount, std::max(first + 1, first * 2));
+    for (int id = first; id < next->categoryCount; ++id) {
+        buildCategory(CategoryId(id));
+        const UnitCategoryPrivate *category = UnitCategoryPrivate::get(m_categories[id]);
+        for (const auto &[name, unit] : category->m_unitMap.asKeyValueRange()) {
+            if (!next->units.contains(name)) {
+                next->units.insert(name, unit);
+            }
+        }
+        for (const auto &[key, unit] : category->m_normalizedUnitMap.asKeyValueRange()) {
+            if (!next->normalizedUnits.contains(key)) {
+                next->normalizedUnits.insert(key, unit);
+            }
+        }
+    }
+
+    if (next->categoryCount == CategoryCount) {
+        // either there was no name cache or it did not match the categories
+        writeUnitNameCache(*next);
+    }
+
+    current = next.get();
+    m_unitIndexes.push_back(std::move(next));
+    m_unitIndex.storeRelease(current);
+    return current;
+}
+
+const ConverterPrivate::UnitIndex *ConverterPrivate::completeUnitIndex()
+{
+    const UnitIndex *index = m_unitIndex.loadAcquire();
+    while (!index || index->categoryCount < CategoryCount) {
+        index = extendUnitIndex(index);
+    }
+    return index;
+}
+
+const ConverterPrivate::UnitNameCache *ConverterPrivate::unitNameCache()
+{
+    if (!m_unitNameCacheRead.loadAcquire()) {
+        QMutexLocker locker(&m_mutex);
+        if (!m_unitNameCacheRead.loadRelaxed()) {
+            m_unitNameCache = readUnitNameCache();
+            m_unitNameCacheRead.storeRelease(1);
+        }
+    }
+    return m_unitNameCache.get();
+}
+
+std::unique_ptr<const ConverterPrivate::UnitNameCache> ConverterPrivate::readUnitNameCache()
+{
+    const QStringList languages = KLocalizedString::languages();
+    QFile file(unitNameCacheLocation(languages));
+    if (!file.open(QIODevice::ReadOnly)) {
+        return nullptr;
+    }
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_6_0);
+    quint32 magic = 0;
+    quint32 version = 0;
+    QString key;
+    stream >> magic >> version >> key;
+    if (stream.status() != QDataStream::Ok || magic != UnitNameCacheMagic || version != UnitNameCacheVersion || key != unitNameCacheKey(languages)) {
+        qCDebug(LOG_KUNITCONVERSION) << "unit name cache outdated:" << file.fileName();
+        return nullptr;
+    }
+    auto cache = std::make_unique<UnitNameCache>();
+    stream >> cache->categories >> cache->normalizedCategories;
+    if (stream.status() != QDataStream::Ok) {
+        qCDebug(LOG_KUNITCONVERSION) << "unit name cache corrupt:" << file.fileName();
+        return nullptr;
+    }
+    return cache;
+}
+
+void ConverterPrivate::writeUnitNameCache(const UnitIndex &index)
+{
+    const QStringList languages = KLocalizedString::languages();
+    const QString path = unitNameCacheLocation(languages);
+    QDir().mkpath(QFileInfo(path).absolutePath());
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qCDebug(LOG_KUNITCONVERSION) << "cannot write unit name cache:" << file.errorString();
+        return;
+    }
+
+    UnitNameCache cache;
+    for (const auto &[name, unit] : index.units.asKeyValueRange()) {
+        cache.categories.insert(name, unit.categoryId());
+    }
+    for (const auto &[key, unit] : index.normalizedUnits.asKeyValueRange()) {
+        cache.normalizedCategories.insert(key, unit.categoryId());
+    }
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_6_0);
+    stream << UnitNameCacheMagic << UnitNameCacheVersion << unitNameCacheKey(languages) << cache.categories << cache.normalizedCategories;
+    if (!file.commit()) {
+        qCDebug(LOG_KUNITCONVERSION) << "cannot write unit name cache:" << file.errorString();
+    }
+}
+
+const UnitTrie *ConverterPrivate::unitTrie()
+{
+    if (const UnitTrie *trie = m_unitTrie.loadAcquire()) {
+        return trie;
+    }
+
+    QMutexLocker locker(&m_mutex);
+    if (!m_unitTrieData) {
+        // categories in id order, so names shared between categories resolve like in the name index
+        QList<std::pair<QString, Unit>> units;
+        for (int id = 0; id < CategoryCount; ++id) {
+            buildCategory(CategoryId(id));
+            for (const auto &[name, unit] : UnitCategoryPrivate::get(m_categories[id])->m_unitMap.asKeyValueRange()) {
+                units.append({name, unit});
+            }
+        }
+        m_unitTrieData = std::make_unique<const UnitTrie>(units);
+        m_unitTrie.storeRelease(m_unitTrieData.get());
+    }
+    return m_unitTrieData.get();
+}
+
+QSpan<const UnitCategory> ConverterPrivate::categories()
+{
+    for (int id = 0; id < CategoryCount; ++id) {
+        category(CategoryId(id));
+    }
+    return m_categories;
+}
+
+QSpan<const Unit> ConverterPrivate::allUnits()
+{
+    if (const QList<Unit> *units = m_allUnits.loadAcquire()) {
+        return *units;
+    }
+
+    auto units = std::make_unique<QList<Unit>>();
+    for (const UnitCategory &category : categories()) {
+        units->append(UnitCategoryPrivate::get(category)->m_units);
+    }
+
+    QMutexLocker locker(&m_mutex);
+    if (!m_allUnitsData) {
+        m_allUnitsData = std::move(units);
+        m_allUnits.storeRelease(m_allUnitsData.get());
+    }
+    return *m_allUnitsData;
+}
+
+ConverterPrivate *ConverterPrivate::instance()
+{
+    // intentionally leaked and never destroyed, static Value, Quantity and
+    // Converter objects may still use it from their destructors at exit
+    static const auto *d = new QExplicitlySharedDataPointer<ConverterPrivate>(new ConverterPrivate());
+    return d->data();
+}
 
 Converter::Converter()
-    : d(global_converter->d)
+    : d(ConverterPrivate::instance())
 {
 }
 
@@ -96,6 +474,13 @@ Converter::~Converter()
 {
 }
 
+const Converter &Converter::global()
+{
+    // intentionally leaked, it keeps the shared data alive for good
+    static const Converter *converter = new Converter();
+    return *converter;
+}
+
 Converter::Converter(const Converter &other)
     : d(other.d)
 {
@@ -115,34 +500,103 @@ Converter &Converter::operator=(Converter &&other)
 
 Value Converter::convert(const Value &value, const QString &toUnit) const
 {
-    if (d && value.unit().isValid()) {
-        return value.unit().category().convert(value, toUnit);
+    if (d) {
+        return value.convertTo(toUnit);
     }
     return Value();
 }
 
 Value Converter::convert(const Value &value, UnitId toUnit) const
 {
-    if (d && value.unit().isValid()) {
-        return value.unit().category().convert(value, toUnit);
+    if (d) {
+        return value.convertTo(toUnit);
     }
     return Value();
 }
 
 Value Converter::convert(const Value &value, const Unit &toUnit) const
 {
-    if (d && toUnit.isValid() && value.unit().isValid()) {
-        return value.unit().category().convert(value, toUnit);
+    if (d) {
+        return value.convertTo(toUnit);
     }
     return Value();
 }
 
+template<typename T>
+static bool convertRange(ConverterPrivate *d, QSpan<const T> input, UnitId fromUnit, UnitId toUnit, QSpan<T> output)
+{
+    if (!d || output.size() < input.size()) {
+        return false;
+    }
+    const Unit *from = d->unit(fromUnit);
+    const Unit *to = d->unit(toUnit);
+    if (!from || !to) {
+        return false;
+    }
+    const ConversionKernel kernel = UnitCategoryPrivate::kernelFor(*from, *to);
+    if (kernel.m_kind == ConversionKernel::Invalid) {
+        return false;
+    }
+    kernel.apply(input, output);
+    return true;
+}
+
+bool Converter::convert(QSpan<const qreal> input, UnitId fromUnit, UnitId toUnit, QSpan<qreal> output) const
+{
+    return convertRange(d.data(), input, fromUnit, toUnit, output);
+}
+
+bool Converter::convert(QSpan<qreal> numbers, UnitId fromUnit, UnitId toUnit) const
+{
+    return convert(numbers, fromUnit, toUnit, numbers);
+}
+
+bool Converter::convert(QSpan<const float> input, UnitId fromUnit, UnitId toUnit, QSpan<float> output) const
+{
+    return convertRange(d.data(), input, fromUnit, toUnit, output);
+}
+
+bool Converter::convert(QSpan<float> numbers, UnitId fromUnit, UnitId toUnit) const
+{
+    return convert(numbers, fromUnit, toUnit, numbers);
+}
+
+bool Converter::convert(QSpan<const qreal> input, QSpan<const UnitId> fromUnits, UnitId toUnit, QSpan<qreal> output) const
+{
+    if (!d || fromUnits.size() < input.size() || output.size() < input.size()) {
+        return false;
+    }
+    const Unit *to = d->unit(toUnit);
+    if (!to || !to->isValid()) {
+        return false;
+    }
+    UnitCategoryPrivate::convertMixed(input, fromUnits, *to, output);
+    return true;
+}
+
+bool Converter::toBestUnits(QSpan<const qreal> input, UnitId fromUnit, QSpan<qreal> output, QSpan<UnitId> units) const
+{
+    if (!d || output.size() < input.size() || units.size() < input.size()) {
+        return false;
+    }
+    const Unit *from = d->unit(fromUnit);
+    if (!from || !from->isValid()) {
+        return false;
+    }
+    UnitCategoryPrivate::toBestUnits(*from, input, output, units);
+    return true;
+}
+
+ConversionPlan Converter::conversionPlan(UnitId fromUnit, UnitId toUnit) const
+{
+    return ConversionPlan(unit(fromUnit), unit(toUnit));
+}
+
 UnitCategory Converter::categoryForUnit(const QString &unit) const
 {
-    const auto lstCategories = categories();
-    for (const UnitCategory &u : lstCategories) {
-        if (u.hasUnit(unit)) {
-            return u;
+    if (d) {
+        if (const Unit *u = d->unit(unit)) {
+            return u->category();
         }
     }
     return UnitCategory();
@@ -150,32 +604,63 @@ UnitCategory Converter::categoryForUnit(const QString &unit) const
 
 Unit Converter::unit(const QString &unitString) const
 {
-    const auto lstCategories = categories();
-    for (const UnitCategory &u : lstCategories) {
-        Unit unitClass = u.unit(unitString);
-        if (unitClass.isValid()) {
-            return unitClass;
+    if (d) {
+        if (const Unit *unit = d->unit(unitString)) {
+            return *unit;
         }
     }
     return Unit();
 }
 
+Unit Converter::unit(const QString &unitString, UnitMatchMode mode) const
+{
+    if (d) {
+        if (const Unit *unit = d->unit(unitString, mode)) {
+            return *unit;
+        }
+    }
+    return Unit();
+}
+
+QStringList Converter::unitNamesStartingWith(QStringView prefix, Qt::CaseSensitivity cs, qsizetype maxCount) const
+{
+    if (d) {
+        return d->unitTrie()->namesStartingWith(prefix, cs, maxCount);
+    }
+    return QStringList();
+}
+
+QStringList Converter::similarUnitNames(QStringView unitString, qsizetype maxCount, int maxDistance) const
+{
+    if (d) {
+        return d->unitTrie()->similarNames(unitString, maxCount, maxDistance);
+    }
+    return QStringList();
+}
+
 Unit Converter::unit(UnitId unitId) const
 {
-    const auto lstCategories = categories();
-    for (const UnitCategory &u : lstCategories) {
-        Unit unitClass = u.unit(unitId);
-        if (unitClass.isValid()) {
-            return unitClass;
+    if (d) {
+        if (const Unit *unit = d->unit(unitId)) {
+            return *unit;
         }
     }
     return Unit();
 }
 
+UnitCategory Converter::categoryForUnitId(UnitId unitId) const
+{
+    if (d) {
+        if (const Unit *unit = d->unit(unitId)) {
+            return unit->category();
+        }
+    }
+    return UnitCategory();
+}
+
 UnitCategory Converter::category(const QString &category) const
 {
-    const auto lstCategories = categories();
-    for (const UnitCategory &u : lstCategories) {
+    for (const UnitCategory &u : categoriesView()) {
         if (u.name() == category) {
             return u;
         }
@@ -186,8 +671,10 @@ UnitCategory Converter::category(const QString &category) const
 
 UnitCategory Converter::category(CategoryId categoryId) const
 {
-    if (d && d->m_categories.contains(categoryId)) {
-        return d->m_categories[categoryId];
+    if (d) {
+        if (const UnitCategory *category = d->category(categoryId)) {
+            return *category;
+        }
     }
     // not found
     return UnitCategory();
@@ -196,9 +683,26 @@ UnitCategory Converter::category(CategoryId categoryId) const
 QList<UnitCategory> Converter::categories() const
 {
     if (d) {
-        return d->m_categories.values();
+        const QSpan<const UnitCategory> categories = d->categories();
+        return QList<UnitCategory>(categories.begin(), categories.end());
     }
     return QList<UnitCategory>();
 }
 
+QSpan<const UnitCategory> Converter::categoriesView() const
+{
+    if (d) {
+        return d->categories();
+    }
+    return {};
+}
+
+QSpan<const Unit> Converter::allUnitsView() const
+{
+    if (d) {
+        return d->allUnits();
+    }
+    return {};
+}
+
 }
@@ -10,9 +10,13 @@
 
 #include <kunitconversion/kunitconversion_export.h>
 
+#include "conversionplan.h"
 #include "unitcategory.h"
 
 #include <QExplicitlySharedDataPointer>
+#include <QSpan>
+#include <QStringList>
+#include <QStringView>
 
 namespace KUnitConversion
 {
@@ -46,6 +50,22 @@ public:
 
     Converter &operator=(Converter &&other);
 
+    /*!
+     * Returns the converter shared by the whole process.
+     *
+     * All converters use the same data, creating or copying one takes a
+     * reference on it. When many threads convert at once these references
+     * make them contend on one counter, using this instance takes none. It
+     * is never destroyed, so it can also be used from global destructors.
+     *
+     * Conversions through Value, Quantity and this instance take no reference
+     * on the converter, units or categories beyond the units held by the
+     * values they return.
+     *
+     * \since 6.28
+     */
+    static const Converter &global();
+
     /*!
      * Convert value to another unit.
      *
@@ -67,6 +87,117 @@ public:
      */
     Value convert(const Value &value, const Unit &toUnit) const;
 
+    /*!
+     * Convert a range of numbers to another unit.
+     *
+     * The units are resolved once for the whole range, which makes this considerably
+     * cheaper than converting a Value per number. The numbers are converted like
+     * ConversionPlan does and may differ from Value::convertTo() in the last bits
+     * as documented there.
+     *
+     * \a input numbers to convert
+     *
+     * \a fromUnit unit of the numbers in \a input
+     *
+     * \a toUnit unit to convert to
+     *
+     * \a output receives the converted numbers, must be at least as large as \a input.
+     * May be the same range as \a input.
+     *
+     * Returns \c false if one of the units is invalid, if the units belong to different
+     * categories or if \a output is too small, \c true otherwise.
+     *
+     * \since 6.28
+     **/
+    bool convert(QSpan<const qreal> input, UnitId fromUnit, UnitId toUnit, QSpan<qreal> output) const;
+
+    /*!
+     * \overload Converter::convert()
+     *
+     * Convert a range of numbers to another unit in place.
+     *
+     * \since 6.28
+     **/
+    bool convert(QSpan<qreal> numbers, UnitId fromUnit, UnitId toUnit) const;
+
+    /*!
+     * \overload Converter::convert()
+     *
+     * Convert a range of single precision numbers to another unit. The conversion
+     * is computed in double precision and rounded once to single precision.
+     *
+     * \since 6.28
+     **/
+    bool convert(QSpan<const float> input, UnitId fromUnit, UnitId toUnit, QSpan<float> output) const;
+
+    /*!
+     * \overload Converter::convert()
+     *
+     * Convert a range of single precision numbers to another unit in place.
+     *
+     * \since 6.28
+     **/
+    bool convert(QSpan<float> numbers, UnitId fromUnit, UnitId toUnit) const;
+
+    /*!
+     * \overload Converter::convert()
+     *
+     * Convert a range of numbers, each in its own unit, to one unit.
+     *
+     * The factors from all units of the category of \a toUnit are gathered into
+     * a table once for the whole range, so normalizing numbers in mixed units such
+     * as kilograms, pounds and ounces needs neither a Value nor a unit lookup per
+     * number. Numbers in units that are not a multiple of \a toUnit, such as
+     * temperatures, take a slower path.
+     *
+     * \a input numbers to convert
+     *
+     * \a fromUnits unit of the number at the same position in \a input, must be
+     * at least as large as \a input. Numbers in an invalid unit or a unit of another
+     * category than \a toUnit are converted to NaN.
+     *
+     * \a toUnit unit to convert to
+     *
+     * \a output receives the converted numbers, must be at least as large as \a input.
+     * May be the same range as \a input.
+     *
+     * Returns \c false if \a toUnit is invalid or if \a fromUnits or \a output is
+     * too small, \c true otherwise.
+     *
+     * \since 6.28
+     **/
+    bool convert(QSpan<const qreal> input, QSpan<const UnitId> fromUnits, UnitId toUnit, QSpan<qreal> output) const;
+
+    /*!
+     * Convert each of a range of numbers to its best unit, like Value::toBestUnit().
+     *
+     * The unit system is looked up once for the whole range, so this is much
+     * faster than converting the numbers one by one.
+     *
+     * \a input numbers to convert
+     *
+     * \a fromUnit unit of the numbers in \a input
+     *
+     * \a output receives the converted numbers, must be at least as large as \a input.
+     * May be the same range as \a input.
+     *
+     * \a units receives the unit of each converted number, must be at least as large as \a input.
+     *
+     * Returns \c false if \a fromUnit is invalid or if \a output or \a units is too small,
+     * \c true otherwise.
+     *
+     * \since 6.28
+     **/
+    bool toBestUnits(QSpan<const qreal> input, UnitId fromUnit, QSpan<qreal> output, QSpan<UnitId> units) const;
+
+    /*!
+     * Create a plan for repeated conversions from \a fromUnit to \a toUnit.
+     *
+     * \sa ConversionPlan
+     * \since 6.28
+     **/
+    ConversionPlan conversionPlan(UnitId fromUnit, UnitId toUnit) const;
+
     /*!
      * Find unit category for unit.
      *
@@ -76,6 +207,17 @@ public:
      **/
     UnitCategory categoryForUnit(const QString &unit) const;
 
+    /*!
+     * Find unit category for unit enum.
+     *
+     * \a unitId unit enum to find category for.
+     *
+     * Returns unit category for unit or invalid category.
+     *
+     * \since 6.28
+     **/
+    UnitCategory categoryForUnitId(UnitId unitId) const;
+
     /*!
      * Find unit for string unit.
      *
@@ -85,6 +227,47 @@ public:
      **/
     Unit unit(const QString &unitString) const;
 
+    /*!
+     * Find unit for string unit, matched according to \a mode.
+     *
+     * \a unitString unit string to find unit for.
+     *
+     * Returns unit for string unit
+     *
+     * \since 6.28
+     **/
+    Unit unit(const QString &unitString, UnitMatchMode mode) const;
+
+    /*!
+     * Find the unit names and synonyms of all categories starting with
+     * \a prefix, e.g. to complete user input.
+     *
+     * \a cs whether the case of \a prefix has to match
+     *
+     * \a maxCount maximum number of names to return, all if negative
+     *
+     * Returns the names sorted ignoring case.
+     *
+     * \since 6.28
+     **/
+    QStringList unitNamesStartingWith(QStringView prefix, Qt::CaseSensitivity cs = Qt::CaseInsensitive, qsizetype maxCount = -1) const;
+
+    /*!
+     * Find the unit names and synonyms of all categories closest to
+     * \a unitString, e.g. to suggest corrections when unit() finds nothing.
+     *
+     * Names are compared ignoring case. \a maxDistance is the largest number
+     * of characters that may have to be inserted, removed or replaced to turn
+     * a name into \a unitString.
+     *
+     * \a maxCount maximum number of names to return, all if negative
+     *
+     * Returns the names, the closest first.
+     *
+     * \since 6.28
+     **/
+    QStringList similarUnitNames(QStringView unitString, qsizetype maxCount = 5, int maxDistance = 2) const;
+
     /*!
      * Find unit for unit enum.
      *
@@ -117,6 +300,30 @@ public:
      **/
     QList<UnitCategory> categories() const;
 
+    /*!
+     * Returns all unit categories ordered by CategoryId without copying them.
+     *
+     * The categories live as long as the converter data, i.e. for the rest
+     * of the process.
+     *
+     * \sa categories()
+     * \since 6.28
+     **/
+    QSpan<const UnitCategory> categoriesView() const;
+
+    /*!
+     * Returns the units of all categories without copying them, grouped by
+     * category in CategoryId order and in the order of UnitCategory::units()
+     * within a category.
+     *
+     * The units live as long as the converter data, i.e. for the rest of the
+     * process.
+     *
+     * \sa UnitCategory::unitsView()
+     * \since 6.28
+     **/
+    QSpan<const Unit> allUnitsView() const;
+
 private:
     QExplicitlySharedDataPointer<ConverterPrivate> d;
 };
@@ -0,0 +1,142 @@
+/*
+ *   SPDX-FileCopyrightText: 2026 KUnitConversion Authors
+ *
+ *   SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#ifndef KUNITCONVERSION_CONVERTER_P_H
+#define KUNITCONVERSION_CONVERTER_P_H
+
+#include "converter.h"
+#include "unittrie_p.h"
+
+#include <QAtomicInt>
+#include <QAtomicPointer>
+#include <QHash>
+#include <QList>
+#include <QMutex>
+#include <QSpan>
+
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace KUnitConversion
+{
+/**
+ * Categories are built on first use, so that a process converting only
+ * lengths does not pay for creating and translating every other unit.
+ * All lookups are thread-safe, a category is never modified once built.
+ */
+class KUNITCONVERSION_EXPORT ConverterPrivate : public QSharedData
+{
+public:
+    ConverterPrivate();
+    ~ConverterPrivate();
+
+    /** Category @p categoryId, built if needed, nullptr for invalid ids. */
+    const UnitCategory *category(CategoryId categoryId)
+    {
+        if (categoryId < 0 || categoryId >= CategoryCount) {
+            return nullptr;
+        }
+        if (!m_built[categoryId].loadAcquire()) {
+            QMutexLocker locker(&m_mutex);
+            buildCategory(categoryId);
+        }
+        return &m_categories[categoryId];
+    }
+
+    /** Unit @p unitId, building only its category, nullptr for unknown ids. */
+    const Unit *unit(UnitId unitId)
+    {
+        const CategoryId categoryId = categoryForUnitId(unitId);
+        if (!category(categoryId)) {
+            return nullptr;
+        }
+        const QList<Unit> &units = m_unitsById[categoryId];
+        const qsizetype offset = unitId % UnitIdBlockSize;
+        if (offset >= units.size() || units[offset].isNull()) {
+            return nullptr;
+        }
+        return &units[offset];
+    }
+
+    /** Unit named @p name in the first category that knows the name, nullptr if there is none. */
+    const Unit *unit(const QString &name);
+
+    /** Unit named @p name matched according to @p mode, preferring an exact match. */
+    const Unit *unit(const QString &name, UnitMatchMode mode);
+
+    /** Trie over the unit names of all categories, building them if needed. */
+    const UnitTrie *unitTrie();
+
+    /** All categories in id order, building the ones not built yet. */
+    QSpan<const UnitCategory> categories();
+
+    /** Units of all categories in category id order, building the categories if needed. */
+    QSpan<const Unit> allUnits();
+
+    /** Indicates if category @p categoryId is built yet, without building it. */
+    bool isBuilt(CategoryId categoryId) const
+    {
+        return m_built[categoryId].loadAcquire();
+    }
+
+    /** Category of the UnitId block @p unitId belongs to, without building anything. */
+    static CategoryId categoryForUnitId(UnitId unitId);
+
+    /** The global converter data shared by all Converter instances, it is never destroyed. */
+    static ConverterPrivate *instance();
+
+    // UnitId values are allocated in blocks of 1000 per category (see unit.h)
+    static constexpr qsizetype UnitIdBlockSize = 1000;
+    // CategoryId values are dense, starting at 0
+    static constexpr int CategoryCount = BinaryDataCategory + 1;
+
+private:
+    /** Name index over the categories [0, categoryCount), immutable once published. */
+    struct UnitIndex {
+        QHash<QString, Unit> units;
+        QHash<QString, Unit> normalizedUnits; //!< by UnitCategoryPrivate::normalizedName()
+        int categoryCount = 0;
+    };
+
+    /**
+     * Lowest category id knowing each unit name in the current translation languages, written
+     * to disk once all categories were built for a lookup, so that lookups in later processes
+     * only build the category of the unit and unknown names none at all.
+     */
+    struct UnitNameCache {
+        QHash<QString, CategoryId> categories;
+        QHash<QString, CategoryId> normalizedCategories; //!< by UnitCategoryPrivate::normalizedName()
+    };
+
+    void buildCategory(CategoryId categoryId);
+    const UnitIndex *extendUnitIndex(const UnitIndex *index);
+    /** The name index over all categories, building them if needed. */
+    const UnitIndex *completeUnitIndex();
+
+    /** The name cache read on first use, nullptr if there is none for the current translations. */
+    const UnitNameCache *unitNameCache();
+    static std::unique_ptr<const UnitNameCache> readUnitNameCache();
+    static void writeUnitNameCache(const UnitIndex &index);
+
+    QMutex m_mutex; //!< serializes building categories and name indexes
+    // indexed by CategoryId, the categories are contiguous so that they can be handed out as one span
+    std::array<QAtomicInt, CategoryCount> m_built;
+    std::array<UnitCategory, CategoryCount> m_categories;
+    std::array<QList<Unit>, CategoryCount> m_unitsById; //!< units by offset of their id within the id block
+    QAtomicPointer<const UnitIndex> m_unitIndex;
+    std::vector<std::unique_ptr<const UnitIndex>> m_unitIndexes; //!< every published index, lookups may still use older ones
+    QAtomicInt m_unitNameCacheRead; //!< indicates if reading the name cache was tried, successful or not
+    std::unique_ptr<const UnitNameCache> m_unitNameCache;
+    QAtomicPointer<const UnitTrie> m_unitTrie;
+    std::unique_ptr<const UnitTrie> m_unitTrieData;
+    QAtomicPointer<const QList<Unit>> m_allUnits;
+    std::unique_ptr<const QList<Unit>> m_allUnitsData;
+};
+
+} // KUnitConversion namespace
+
+#endif // KUNITCONVERSION_CONVERTER_P_H
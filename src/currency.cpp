@@ -6,14 +6,17 @@
  */
 
 #include "currency_p.h"
+#include "converter_p.h"
 #include "kunitconversion_debug.h"
 #include "unit_p.h"
 #include "unitcategory.h"
 #include <KLocalizedString>
 #include <QDateTime>
+#include <QByteArrayView>
 #include <QDir>
 #include <QFileInfo>
 #include <QLocale>
+#include <QMutex>
 #include <QNetworkAccessManager>
 #include <QNetworkInterface>
 #include <QNetworkReply>
@@ -22,6 +25,10 @@
 #include <QStandardPaths>
 #include <QXmlStreamReader>
 
+#include <cstring>
+#include <memory>
+#include <vector>
+
 using namespace std::chrono_literals;
 
 namespace KUnitConversion
@@ -37,6 +44,47 @@ static QString cacheLocation()
 #endif
 }
 
+static QString rateCacheLocation(const QString &tablePath)
+{
+    return tablePath + QStringLiteral(".rates");
+}
+
+/*
+ * The rate cache is a binary copy of the rates read from a conversion table,
+ * so that other processes can map it instead of parsing the XML. It is only
+ * valid for the table with the modification time in its header.
+ */
+struct RateCacheHeader {
+    quint32 magic;
+    quint32 version;
+    qint64 tableTimestamp; //!< modification time of the conversion table in msecs since epoch
+    quint32 count;
+    quint32 checksum; //!< qChecksum() of the entries
+};
+
+struct RateCacheEntry {
+    qint32 unitId;
+    quint32 reserved;
+    double multiplier;
+};
+
+static_assert(sizeof(RateCacheHeader) == 24 && sizeof(RateCacheEntry) == 16, "rate cache layout must not depend on padding");
+
+static constexpr quint32 RateCacheMagic = 0x4b554352; // "KUCR", also detects byte order
+static constexpr quint32 RateCacheVersion = 1;
+
+/**
+ * Immutable set of currency rates, replaced as a whole when a conversion table is read.
+ */
+struct CurrencyRates {
+    qreal multiplier(UnitId unitId) const
+    {
+        return m_multipliers.value(unitId - Eur, qQNaN());
+    }
+
+    QList<qreal> m_multipliers; //!< by offset of the unit id from Eur
+};
+
 class CurrencyCategoryPrivate : public UnitCategoryPrivate
 {
 public:
@@ -45,19 +93,87 @@ public:
     {
     }
 
-    Value convert(const Value &value, const Unit &toUnit) override;
+    qreal convert(const Unit &fromUnit, const Unit &toUnit, qreal value) override;
+    ConversionKernel conversionKernel(const Unit &fromUnit, const Unit &toUnit) override;
+    void convertToAll(const Unit &fromUnit, qreal number, QSpan<const Unit> units, QSpan<qreal> output) override;
+    void convertFromUnits(QSpan<const qreal> input, QSpan<const UnitId> fromUnits, const Unit &toUnit, QSpan<qreal> output) override;
     bool hasOnlineConversionTable() const override;
     UpdateJob* syncConversionTable(std::chrono::seconds updateSkipSeconds) override;
 
-    QNetworkReply *m_currentReply = nullptr;
+    /** Current rates, reading the cached conversion table first if that did not happen yet. */
+    const CurrencyRates *rates();
+    /** Publishes the static rates of all units, called once all units are added. */
+    void initRates();
+    /** Makes @p rates the current rates, requires m_mutex to be locked once the category is built. */
+    void publishRates(std::unique_ptr<const CurrencyRates> rates);
+    /** Reads a conversion table and publishes the new rates, requires m_mutex to be locked. */
     bool readConversionTable(const QString &cacheLocation);
-    bool m_initialized{false}; //!< indicates if units are prepared from currency table
+    /** Reads the rate cache of a conversion table and publishes its rates, requires m_mutex to be locked. */
+    bool readRateCache(const QString &cacheLocation);
+    /** Writes the current rates to the rate cache of a conversion table, requires m_mutex to be locked. */
+    void writeRateCache(const QString &cacheLocation);
+
+    QNetworkReply *m_currentReply = nullptr;
+    QMutex m_mutex; //!< serializes reading conversion tables
+    QAtomicInt m_readAttempted; //!< indicates if reading the cached currency table was tried, successful or not
+    bool m_tableRead = false; //!< indicates if rates are read from a currency table, guarded by m_mutex
+    QAtomicPointer<const CurrencyRates> m_rates;
+    /**
+     * All rates ever published, kept until the category is deleted since conversions
+     * running concurrently may still read older rates without locking.
+     * A new set is only published per conversion table read.
+     */
+    std::vector<std::unique_ptr<const CurrencyRates>> m_publishedRates;
 };
 
-bool CurrencyCategoryPrivate::hasOnlineConversionTable() const
+/**
+ * Currency unit reading its multiplier from the current rates of the category,
+ * the multiplier of the unit itself is the static rate used before any
+ * conversion table was read.
+ */
+class CurrencyUnitPrivate : public UnitPrivate
 {
-    return true;
-}
+public:
+    using UnitPrivate::UnitPrivate;
+
+    qreal toDefault(qreal value) const override
+    {
+        return value * rate();
+    }
+
+    qreal fromDefault(qreal value) const override
+    {
+        return value / rate();
+    }
+
+    UnitTransform transform() const override
+    {
+        return {UnitTransform::Linear, rate(), 0.0};
+    }
+
+    static inline Unit makeUnit(CategoryId categoryId,
+                                UnitId id,
+                                qreal multiplier,
+                                const QString &symbol,
+                                const QString &description,
+                                const QString &matchString,
+                                const KLocalizedString &symbolString,
+                                const KLocalizedString &realString,
+                                const KLocalizedString &integerString)
+    {
+        return UnitPrivate::makeUnit(
+            new CurrencyUnitPrivate(categoryId, id, multiplier, symbol, description, matchString, symbolString, realString, integerString));
+    }
+
+private:
+    qreal rate() const
+    {
+        if (m_category) {
+            return static_cast<CurrencyCategoryPrivate *>(m_category)->rates()->multiplier(m_id);
+        }
+        return m_multiplier;
+    }
+};
 
 UnitCategory Currency::makeCategory()
 {
@@ -66,7 +182,7 @@ UnitCategory Currency::makeCategory()
     KLocalizedString symbolString = ki18nc("%1 value, %2 unit symbol (currency)", "%1 %2");
 
     // Static rates
-    d->addDefaultUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addDefaultUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                               Eur,
                               1.0,
                               QStringLiteral("EUR"),
@@ -77,7 +193,7 @@ UnitCategory Currency::makeCategory()
                               ki18nc("amount in units (real)", "%1 euros"),
                               ki18ncp("amount in units (integer)", "%1 euro", "%1 euros")));
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Ats,
                        0.0726728,
                        QStringLiteral("ATS"),
@@ -88,7 +204,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 schillings"),
                        ki18ncp("amount in units (integer)", "%1 schilling", "%1 schillings")));
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Bef,
                        0.0247894,
                        QStringLiteral("BEF"),
@@ -99,7 +215,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 Belgian francs"),
                        ki18ncp("amount in units (integer)", "%1 Belgian franc", "%1 Belgian francs")));
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Nlg,
                        0.45378,
                        QStringLiteral("NLG"),
@@ -110,7 +226,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 guilders"),
                        ki18ncp("amount in units (integer)", "%1 guilder", "%1 guilders")));
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Fim,
                        0.168188,
                        QStringLiteral("FIM"),
@@ -121,7 +237,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 markkas"),
                        ki18ncp("amount in units (integer)", "%1 markka", "%1 markkas"))); // Alternative = markkaa
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Frf,
                        0.152449,
                        QStringLiteral("FRF"),
@@ -132,7 +248,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 French francs"),
                        ki18ncp("amount in units (integer)", "%1 French franc", "%1 French francs")));
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Dem,
                        0.511292,
                        QStringLiteral("DEM"),
@@ -143,7 +259,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 marks"),
                        ki18ncp("amount in units (integer)", "%1 mark", "%1 marks")));
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Iep,
                        1.26974,
                        QStringLiteral("IEP"),
@@ -154,7 +270,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 Irish pounds"),
                        ki18ncp("amount in units (integer)", "%1 Irish pound", "%1 Irish pounds")));
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Itl,
                        0.000516457,
                        QStringLiteral("ITL"),
@@ -165,7 +281,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 Italian lira"),
                        ki18ncp("amount in units (integer)", "%1 Italian lira", "%1 Italian lira")));
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Luf,
                        0.0247894,
                        QStringLiteral("LUF"),
@@ -176,7 +292,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 Luxembourgish francs"),
                        ki18ncp("amount in units (integer)", "%1 Luxembourgish franc", "%1 Luxembourgish francs")));
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Pte,
                        0.00498798,
                        QStringLiteral("PTE"),
@@ -187,7 +303,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 escudos"),
                        ki18ncp("amount in units (integer)", "%1 escudo", "%1 escudos")));
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Esp,
                        0.00601012,
                        QStringLiteral("ESP"),
@@ -198,7 +314,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 pesetas"),
                        ki18ncp("amount in units (integer)", "%1 peseta", "%1 pesetas")));
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Grd,
                        0.0029347,
                        QStringLiteral("GRD"),
@@ -209,7 +325,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 drachmas"),
                        ki18ncp("amount in units (integer)", "%1 drachma", "%1 drachmas")));
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Sit,
                        0.00417293,
                        QStringLiteral("SIT"),
@@ -220,7 +336,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 tolars"),
                        ki18ncp("amount in units (integer)", "%1 tolar", "%1 tolars"))); // Alt: tolarjev/tolarja/tolarji
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Cyp,
                        1.7086,
                        QStringLiteral("CYP"),
@@ -231,7 +347,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 Cypriot pounds"),
                        ki18ncp("amount in units (integer)", "%1 Cypriot pound", "%1 Cypriot pounds")));
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Mtl,
                        2.32937,
                        QStringLiteral("MTL"),
@@ -242,7 +358,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 Maltese lira"),
                        ki18ncp("amount in units (integer)", "%1 Maltese lira", "%1 Maltese lira")));
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Skk,
                        0.0331939,
                        QStringLiteral("SKK"),
@@ -253,7 +369,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 Slovak korunas"),
                        ki18ncp("amount in units (integer)", "%1 Slovak koruna", "%1 Slovak korunas"))); // Alt: koruny, korun
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                               Xpf,
                               0.00838,
                               QStringLiteral("XPF"),
@@ -265,7 +381,7 @@ UnitCategory Currency::makeCategory()
                               ki18ncp("amount in units (integer)", "%1 CFP franc", "%1 CFP francs")));
 
     // From ECB
-    d->addCommonUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addCommonUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                              Usd,
                              qSNaN(),
                              QStringLiteral("USD"),
@@ -276,7 +392,7 @@ UnitCategory Currency::makeCategory()
                              ki18nc("amount in units (real)", "%1 United States dollars"),
                              ki18ncp("amount in units (integer)", "%1 United States dollar", "%1 United States dollars")));
 
-    d->addCommonUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addCommonUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                              Jpy,
                              qSNaN(),
                              QStringLiteral("JPY"),
@@ -287,7 +403,7 @@ UnitCategory Currency::makeCategory()
                              ki18nc("amount in units (real)", "%1 yen"),
                              ki18ncp("amount in units (integer)", "%1 yen", "%1 yen")));
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Bgn,
                        qSNaN(),
                        QStringLiteral("BGN"),
@@ -298,7 +414,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 leva"),
                        ki18ncp("amount in units (integer)", "%1 lev", "%1 leva")));
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Czk,
                        qSNaN(),
                        QStringLiteral("CZK"),
@@ -310,7 +426,7 @@ UnitCategory Currency::makeCategory()
                        // Alt: koruny, korun
                        ki18ncp("amount in units (integer)", "%1 Czech koruna", "%1 Czech korunas")));
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Dkk,
                        qSNaN(),
                        QStringLiteral("DKK"),
@@ -321,7 +437,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 Danish kroner"),
                        ki18ncp("amount in units (integer)", "%1 Danish krone", "%1 Danish kroner")));
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Eek,
                        qSNaN(),
                        QStringLiteral("EEK"),
@@ -332,7 +448,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 kroons"),
                        ki18ncp("amount in units (integer)", "%1 kroon", "%1 kroons"))); // Alt: krooni
 
-    d->addCommonUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addCommonUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                              Gbp,
                              qSNaN(),
                              QStringLiteral("GBP"),
@@ -344,7 +460,7 @@ UnitCategory Currency::makeCategory()
                              ki18nc("amount in units (real)", "%1 pounds sterling"),
                              ki18ncp("amount in units (integer)", "%1 pound sterling", "%1 pounds sterling")));
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Huf,
                        qSNaN(),
                        QStringLiteral("HUF"),
@@ -355,7 +471,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 forint"),
                        ki18ncp("amount in units (integer)", "%1 forint", "%1 forint")));
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Ils,
                        qSNaN(),
                        QStringLiteral("ILS"),
@@ -367,7 +483,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 shekels"),
                        ki18ncp("amount in units (integer)", "%1 shekel", "%1 shekels")));
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Ltl,
                        qSNaN(),
                        QStringLiteral("LTL"),
@@ -378,7 +494,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 litas"),
                        ki18ncp("amount in units (integer)", "%1 litas", "%1 litai"))); // Alt: litu
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Lvl,
                        qSNaN(),
                        QStringLiteral("LVL"),
@@ -389,7 +505,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 lati"),
                        ki18ncp("amount in units (integer)", "%1 lats", "%1 lati")));
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Pln,
                        qSNaN(),
                        QStringLiteral("PLN"),
@@ -400,7 +516,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 zlotys"),
                        ki18ncp("amount in units (integer)", "%1 zloty", "%1 zlotys"))); // Alt: zloty, zlote, zlotych
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Ron,
                        qSNaN(),
                        QStringLiteral("RON"),
@@ -411,7 +527,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 lei"),
                        ki18ncp("amount in units (integer)", "%1 leu", "%1 lei")));
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Sek,
                        qSNaN(),
                        QStringLiteral("SEK"),
@@ -422,7 +538,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 kronor"),
                        ki18ncp("amount in units (integer)", "%1 krona", "%1 kronor")));
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Chf,
                        qSNaN(),
                        QStringLiteral("CHF"),
@@ -433,7 +549,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 Swiss francs"),
                        ki18ncp("amount in units (integer)", "%1 Swiss franc", "%1 Swiss francs")));
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Nok,
                        qSNaN(),
                        QStringLiteral("NOK"),
@@ -444,7 +560,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 Norwegian kroner"),
                        ki18ncp("amount in units (integer)", "%1 Norwegian krone", "%1 Norwegian kroner")));
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Hrk,
                        1.0/7.53450,
                        QStringLiteral("HRK"),
@@ -455,7 +571,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 kune"),
                        ki18ncp("amount in units (integer)", "%1 kuna", "%1 kune")));
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Rub,
                        qSNaN(),
                        QStringLiteral("RUB"),
@@ -466,7 +582,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 rubles"),
                        ki18ncp("amount in units (integer)", "%1 ruble", "%1 rubles"))); // Alt: rouble/roubles
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Try,
                        qSNaN(),
                        QStringLiteral("TRY"),
@@ -477,7 +593,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 Turkish lira"),
                        ki18ncp("amount in units (integer)", "%1 Turkish lira", "%1 Turkish lira")));
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Aud,
                        qSNaN(),
                        QStringLiteral("AUD"),
@@ -488,7 +604,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 Australian dollars"),
                        ki18ncp("amount in units (integer)", "%1 Australian dollar", "%1 Australian dollars")));
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Brl,
                        qSNaN(),
                        QStringLiteral("BRL"),
@@ -499,7 +615,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 reais"),
                        ki18ncp("amount in units (integer)", "%1 real", "%1 reais")));
 
-    d->addCommonUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addCommonUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                              Cad,
                              qSNaN(),
                              QStringLiteral("CAD"),
@@ -510,7 +626,7 @@ UnitCategory Currency::makeCategory()
                              ki18nc("amount in units (real)", "%1 Canadian dollars"),
                              ki18ncp("amount in units (integer)", "%1 Canadian dollar", "%1 Canadian dollars")));
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Cny,
                        qSNaN(),
                        QStringLiteral("CNY"),
@@ -521,7 +637,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 yuan"),
                        ki18ncp("amount in units (integer)", "%1 yuan", "%1 yuan")));
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Hkd,
                        qSNaN(),
                        QStringLiteral("HKD"),
@@ -532,7 +648,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 Hong Kong dollars"),
                        ki18ncp("amount in units (integer)", "%1 Hong Kong dollar", "%1 Hong Kong dollars")));
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Idr,
                        qSNaN(),
                        QStringLiteral("IDR"),
@@ -543,7 +659,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 rupiahs"),
                        ki18ncp("amount in units (integer)", "%1 rupiah", "%1 rupiahs"))); // Alt: rupiah
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Inr,
                        qSNaN(),
                        QStringLiteral("INR"),
@@ -554,7 +670,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 rupees"),
                        ki18ncp("amount in units (integer)", "%1 rupee", "%1 rupees"))); // Alt: rupee
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Krw,
                        qSNaN(),
                        QStringLiteral("KRW"),
@@ -565,7 +681,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 won"),
                        ki18ncp("amount in units (integer)", "%1 won", "%1 won")));
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Mxn,
                        qSNaN(),
                        QStringLiteral("MXN"),
@@ -576,7 +692,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 Mexican pesos"),
                        ki18ncp("amount in units (integer)", "%1 Mexican peso", "%1 Mexican pesos")));
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Myr,
                        qSNaN(),
                        QStringLiteral("MYR"),
@@ -587,7 +703,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 ringgit"),
                        ki18ncp("amount in units (integer)", "%1 ringgit", "%1 ringgit"))); // Alt: ringgits
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Nzd,
                        qSNaN(),
                        QStringLiteral("NZD"),
@@ -599,7 +715,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 New Zealand dollars"),
                        ki18ncp("amount in units (integer)", "%1 New Zealand dollar", "%1 New Zealand dollars")));
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Php,
                        qSNaN(),
                        QStringLiteral("PHP"),
@@ -610,7 +726,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 Philippine pesos"),
                        ki18ncp("amount in units (integer)", "%1 Philippine peso", "%1 Philippine pesos")));
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Sgd,
                        qSNaN(),
                        QStringLiteral("SGD"),
@@ -621,7 +737,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 Singapore dollars"),
                        ki18ncp("amount in units (integer)", "%1 Singapore dollar", "%1 Singapore dollars")));
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Thb,
                        qSNaN(),
                        QStringLiteral("THB"),
@@ -632,7 +748,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 baht"),
                        ki18ncp("amount in units (integer)", "%1 baht", "%1 baht")));
 
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Zar,
                        qSNaN(),
                        QStringLiteral("ZAR"),
@@ -642,7 +758,7 @@ UnitCategory Currency::makeCategory()
                        symbolString,
                        ki18nc("amount in units (real)", "%1 rand"),
                        ki18ncp("amount in units (integer)", "%1 rand", "%1 rand")));
-    d->addUnit(UnitPrivate::makeUnit(CurrencyCategory,
+    d->addUnit(CurrencyUnitPrivate::makeUnit(CurrencyCategory,
                        Isk,
                        qSNaN(),
                        QStringLiteral("ISK"),
@@ -653,6 +769,7 @@ UnitCategory Currency::makeCategory()
                        ki18nc("amount in units (real)", "%1 Icelandic kronur"),
                        ki18ncp("amount in units (integer)", "%1 Icelandic krona", "%1 Icelandic kronur")));
 
+    static_cast<CurrencyCategoryPrivate *>(d)->initRates();
     return c;
 }
 
@@ -684,11 +801,40 @@ QDateTime Currency::lastConversionTableUpdate()
     }
 }
 
+bool Currency::readRateCache(const QString &tablePath)
+{
+    const UnitCategory category = *ConverterPrivate::instance()->category(CurrencyCategory);
+    auto d = static_cast<CurrencyCategoryPrivate *>(UnitCategoryPrivate::get(category));
+    QMutexLocker locker(&d->m_mutex);
+    const bool ok = d->readRateCache(tablePath);
+    if (ok) {
+        d->m_tableRead = true;
+        d->m_readAttempted.storeRelease(true);
+    }
+    return ok;
+}
+
+bool Currency::readConversionTable(const QString &path)
+{
+    const UnitCategory category = *ConverterPrivate::instance()->category(CurrencyCategory);
+    auto d = static_cast<CurrencyCategoryPrivate *>(UnitCategoryPrivate::get(category));
+    QMutexLocker locker(&d->m_mutex);
+    const bool ok = d->readConversionTable(path);
+    d->m_tableRead = d->m_tableRead || ok;
+    d->m_readAttempted.storeRelease(true);
+    return ok;
+}
+
 UpdateJob* CurrencyCategoryPrivate::syncConversionTable(std::chrono::seconds updateSkipPeriod)
 {
     QFileInfo info(cacheLocation());
     if (info.exists() && info.lastModified().secsTo(QDateTime::currentDateTime()) <= updateSkipPeriod.count()) {
-        return nullptr; // already present and up to date
+        // already present and up to date, but possibly written by another process after the last attempt to read it
+        QMutexLocker locker(&m_mutex);
+        if (!m_tableRead) {
+            m_readAttempted.storeRelease(false);
+        }
+        return nullptr;
     }
     if (!isConnected()) {
         qCInfo(LOG_KUNITCONVERSION) << "currency conversion table update has no network connection, abort update";
@@ -726,18 +872,68 @@ UpdateJob* CurrencyCategoryPrivate::syncConversionTable(std::chrono::seconds upd
             return;
         }
         qCInfo(LOG_KUNITCONVERSION) << "currency conversion table data obtained via network";
-        m_initialized = readConversionTable(cachePath);
+        QMutexLocker locker(&m_mutex);
+        const bool ok = readConversionTable(cachePath);
+        if (ok) {
+            writeRateCache(cachePath);
+        }
+        m_tableRead = m_tableRead || ok;
+        m_readAttempted.storeRelease(true);
     });
 
     return makeUpdateJob(m_currentReply);
 }
 
+void CurrencyCategoryPrivate::initRates()
+{
+    auto rates = std::make_unique<CurrencyRates>();
+    for (const Unit &unit : std::as_const(m_units)) {
+        const qsizetype offset = unit.id() - Eur;
+        if (offset >= rates->m_multipliers.size()) {
+            rates->m_multipliers.resize(offset + 1, qQNaN());
+        }
+        rates->m_multipliers[offset] = unit.d->m_multiplier;
+    }
+    publishRates(std::move(rates));
+}
+
+void CurrencyCategoryPrivate::publishRates(std::unique_ptr<const CurrencyRates> rates)
+{
+    m_rates.storeRelease(rates.get());
+    m_publishedRates.push_back(std::move(rates));
+}
+
+const CurrencyRates *CurrencyCategoryPrivate::rates()
+{
+    // without a table conversions use the static rates, reading is tried again only after a sync
+    if (!m_readAttempted.loadAcquire()) {
+        QMutexLocker locker(&m_mutex);
+        if (!m_readAttempted.loadRelaxed()) {
+            const QString tablePath = cacheLocation();
+            bool ok = readRateCache(tablePath);
+            if (!ok) {
+                ok = readConversionTable(tablePath);
+                if (ok) {
+                    writeRateCache(tablePath);
+                }
+            }
+            m_tableRead = m_tableRead || ok;
+            m_readAttempted.storeRelease(true);
+        }
+    }
+    return m_rates.loadAcquire();
+}
+
 bool CurrencyCategoryPrivate::readConversionTable(const QString &cachePath)
 {
     QFile file(cachePath);
     if (!file.open(QIODevice::ReadOnly)) {
         return false;
     }
+
+    // rates are updated on a copy and published as a whole, conversions on other threads
+    // keep using the previous rates until then
+    auto rates = std::make_unique<CurrencyRates>(*m_rates.loadRelaxed());
     QXmlStreamReader xml(&file);
     while (!xml.atEnd()) {
         xml.readNext();
@@ -745,11 +941,11 @@ bool CurrencyCategoryPrivate::readConversionTable(const QString &cachePath)
         if (xml.isStartElement() && xml.name() == QLatin1String("Cube")) {
             const auto attributes = xml.attributes();
             if (attributes.hasAttribute(QLatin1String("currency"))) {
-                Unit unit = m_unitMap.value(attributes.value(QLatin1String("currency")).toString());
+                const Unit unit = m_unitMap.value(attributes.value(QLatin1String("currency")).toString());
                 if (unit.isValid()) {
                     const auto multiplier = attributes.value(QLatin1String("rate")).toDouble();
                     if (!qFuzzyIsNull(multiplier)) {
-                        unit.setUnitMultiplier(1.0 / multiplier);
+                        rates->m_multipliers[unit.id() - Eur] = 1.0 / multiplier;
                         qCDebug(LOG_KUNITCONVERSION()) << "currency updated:" << unit.description() << multiplier;
                     }
                 }
@@ -761,17 +957,118 @@ bool CurrencyCategoryPrivate::readConversionTable(const QString &cachePath)
         qCCritical(LOG_KUNITCONVERSION) << "currency conversion fetch could not parse obtained XML, update aborted";
         return false;
     }
+
+    publishRates(std::move(rates));
     return true;
 }
 
-Value CurrencyCategoryPrivate::convert(const Value &value, const Unit &to)
+bool CurrencyCategoryPrivate::readRateCache(const QString &tablePath)
 {
-    if (!m_initialized) {
-        m_initialized = readConversionTable(cacheLocation());
+    const QFileInfo tableInfo(tablePath);
+    if (!tableInfo.exists()) {
+        return false;
+    }
+    QFile file(rateCacheLocation(tablePath));
+    if (!file.open(QIODevice::ReadOnly) || file.size() < qint64(sizeof(RateCacheHeader))) {
+        return false;
+    }
+    const uchar *data = file.map(0, file.size());
+    if (!data) {
+        return false;
     }
 
-    Value v = UnitCategoryPrivate::convert(value, to);
-    return v;
+    RateCacheHeader header;
+    memcpy(&header, data, sizeof(header));
+    const qint64 entriesSize = qint64(header.count) * qint64(sizeof(RateCacheEntry));
+    if (header.magic != RateCacheMagic || header.version != RateCacheVersion
+        || header.tableTimestamp != tableInfo.lastModified().toMSecsSinceEpoch() || file.size() != qint64(sizeof(RateCacheHeader)) + entriesSize) {
+        qCDebug(LOG_KUNITCONVERSION) << "currency rate cache outdated or invalid:" << file.fileName();
+        return false;
+    }
+    const QByteArrayView entries(data + sizeof(RateCacheHeader), entriesSize);
+    if (qChecksum(entries) != header.checksum) {
+        qCDebug(LOG_KUNITCONVERSION) << "currency rate cache corrupted:" << file.fileName();
+        return false;
+    }
+
+    auto rates = std::make_unique<CurrencyRates>(*m_rates.loadRelaxed());
+    for (quint32 i = 0; i < header.count; ++i) {
+        RateCacheEntry entry;
+        memcpy(&entry, entries.data() + i * sizeof(RateCacheEntry), sizeof(entry));
+        const qsizetype offset = entry.unitId - Eur;
+        if (offset >= 0 && offset < rates->m_multipliers.size()) {
+            rates->m_multipliers[offset] = entry.multiplier;
+        }
+    }
+
+    publishRates(std::move(rates));
+    return true;
+}
+
+void CurrencyCategoryPrivate::writeRateCache(const QString &tablePath)
+{
+    const CurrencyRates *rates = m_rates.loadRelaxed();
+    QList<RateCacheEntry> entries;
+    entries.reserve(rates->m_multipliers.size());
+    for (qsizetype offset = 0; offset < rates->m_multipliers.size(); ++offset) {
+        entries.append(RateCacheEntry{qint32(Eur + offset), 0, rates->m_multipliers[offset]});
+    }
+    const QByteArrayView entryData(reinterpret_cast<const char *>(entries.constData()), entries.size() * qsizetype(sizeof(RateCacheEntry)));
+    const RateCacheHeader header{RateCacheMagic,
+                                 RateCacheVersion,
+                                 QFileInfo(tablePath).lastModified().toMSecsSinceEpoch(),
+                                 quint32(entries.size()),
+                                 qChecksum(entryData)};
+
+    QSaveFile file(rateCacheLocation(tablePath));
+    if (!file.open(QIODevice::WriteOnly)) {
+        qCDebug(LOG_KUNITCONVERSION) << "currency rate cache not written:" << file.errorString();
+        return;
+    }
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(entryData.data(), entryData.size());
+    if (!file.commit()) {
+        qCWarning(LOG_KUNITCONVERSION) << "currency rate cache not written:" << file.errorString();
+    }
+}
+
+qreal CurrencyCategoryPrivate::convert(const Unit &from, const Unit &to, qreal value)
+{
+    // both rates from the same snapshot
+    const CurrencyRates *currentRates = rates();
+    return value * currentRates->multiplier(from.id()) / currentRates->multiplier(to.id());
+}
+
+ConversionKernel CurrencyCategoryPrivate::conversionKernel(const Unit &fromUnit, const Unit &toUnit)
+{
+    const CurrencyRates *currentRates = rates();
+    ConversionKernel kernel;
+    kernel.m_kind = ConversionKernel::Scale;
+    kernel.m_a = currentRates->multiplier(fromUnit.id()) / currentRates->multiplier(toUnit.id());
+    kernel.m_from = fromUnit.d.data();
+    kernel.m_to = toUnit.d.data();
+    return kernel;
+}
+
+void CurrencyCategoryPrivate::convertToAll(const Unit &fromUnit, qreal number, QSpan<const Unit> units, QSpan<qreal> output)
+{
+    // all rates from the same snapshot
+    const CurrencyRates *currentRates = rates();
+    const qreal value = number * currentRates->multiplier(fromUnit.id());
+    for (qsizetype i = 0; i < units.size(); ++i) {
+        output[i] = value / currentRates->multiplier(units[i].id());
+    }
+}
+
+void CurrencyCategoryPrivate::convertFromUnits(QSpan<const qreal> input, QSpan<const UnitId> fromUnits, const Unit &toUnit, QSpan<qreal> output)
+{
+    // the rates change with every conversion table, so there is no table to cache,
+    // all rates from the same snapshot and units of other categories have no rate
+    const CurrencyRates *currentRates = rates();
+    const qreal toMultiplier = currentRates->multiplier(toUnit.id());
+    for (qsizetype i = 0; i < input.size(); ++i) {
+        output[i] = currentRates->multiplier(fromUnits[i]) / toMultiplier * input[i];
+    }
 }
 
 } // KUnitConversion namespace
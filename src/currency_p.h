@@ -24,6 +24,22 @@ namespace Currency
      * @internal exported for unit tests only
      */
     KUNITCONVERSION_EXPORT QDateTime lastConversionTableUpdate();
+    /**
+     * @brief Reads the conversion table at @p path into the currency units of the global converter
+     *
+     * @return true if the table could be read
+     *
+     * @internal exported for unit tests and benchmarks only
+     */
+    KUNITCONVERSION_EXPORT bool readConversionTable(const QString &path);
+    /**
+     * @brief Reads the binary rate cache of the conversion table at @p tablePath into the global converter
+     *
+     * @return true if the cache exists, is intact and matches the modification time of the table
+     *
+     * @internal exported for unit tests and benchmarks only
+     */
+    KUNITCONVERSION_EXPORT bool readRateCache(const QString &tablePath);
 };
 
 }
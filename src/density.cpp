@@ -20,7 +20,6 @@ UnitCategory Density::makeCategory()
 
     d->addDefaultUnit(UnitPrivate::makeUnit(DensityCategory,
                               KilogramsPerCubicMeter,
-                              1,
                               i18nc("density unit symbol", "kg/m³"),
                               i18nc("unit description in lists", "kilograms per cubic meter"),
                               i18nc("unit synonyms for matching user input", "kilogram per cubic meter;kilograms per cubic meter;kg/m³"),
@@ -31,7 +30,6 @@ UnitCategory Density::makeCategory()
     // source Google calculator
     d->addCommonUnit(UnitPrivate::makeUnit(DensityCategory,
                              KilogramPerLiter,
-                             1000,
                              i18nc("density unit symbol", "kg/l"),
                              i18nc("unit description in lists", "kilograms per liter"),
                              i18nc("unit synonyms for matching user input", "kilogram per liter;kilograms per liter;kg/l"),
@@ -41,7 +39,6 @@ UnitCategory Density::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(DensityCategory,
                        GramPerLiter,
-                       1,
                        i18nc("density unit symbol", "g/l"),
                        i18nc("unit description in lists", "grams per liter"),
                        i18nc("unit synonyms for matching user input", "gram per liter;grams per liter;g/l"),
@@ -51,7 +48,6 @@ UnitCategory Density::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(DensityCategory,
                        GramPerMilliliter,
-                       1000,
                        i18nc("density unit symbol", "g/ml"),
                        i18nc("unit description in lists", "grams per milliliter"),
                        i18nc("unit synonyms for matching user input", "gram per milliliter;grams per milliliter;g/ml"),
@@ -62,7 +58,6 @@ UnitCategory Density::makeCategory()
     // source : Google calculator
     d->addUnit(UnitPrivate::makeUnit(DensityCategory,
                        OuncePerCubicInch,
-                       1729.99404,
                        i18nc("density unit symbol", "oz/in³"),
                        i18nc("unit description in lists", "ounces per cubic inch"),
                        i18nc("unit synonyms for matching user input", "ounce per cubic inch;ounces per cubic inch;oz/in³"),
@@ -72,7 +67,6 @@ UnitCategory Density::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(DensityCategory,
                              OuncePerCubicFoot,
-                             1.00115396,
                              i18nc("density unit symbol", "oz/ft³"),
                              i18nc("unit description in lists", "ounces per cubic foot"),
                              i18nc("unit synonyms for matching user input", "ounce per cubic foot;ounces per cubic foot;oz/ft³"),
@@ -82,7 +76,6 @@ UnitCategory Density::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(DensityCategory,
                        PoundPerCubicInch,
-                       27679.9047,
                        i18nc("density unit symbol", "lb/in³"),
                        i18nc("unit description in lists", "pounds per cubic inch"),
                        i18nc("unit synonyms for matching user input", "pound per cubic inch;pounds per cubic inch;lb/in³"),
@@ -92,7 +85,6 @@ UnitCategory Density::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(DensityCategory,
                        PoundPerCubicFoot,
-                       16.0184634,
                        i18nc("density unit symbol", "lb/ft³"),
                        i18nc("unit description in lists", "pounds per cubic foot"),
                        i18nc("unit synonyms for matching user input", "pound per cubic foot;pounds per cubic foot;lb/ft³"),
@@ -102,7 +94,6 @@ UnitCategory Density::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(DensityCategory,
                        PoundPerCubicYard,
-                       0.593276421,
                        i18nc("density unit symbol", "lb/yd³"),
                        i18nc("unit description in lists", "pounds per cubic yard"),
                        i18nc("unit synonyms for matching user input", "pound per cubic yard;pounds per cubic yard;lb/yd³"),
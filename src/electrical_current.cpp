@@ -21,7 +21,6 @@ UnitCategory ElectricalCurrent::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ElectricalCurrentCategory,
                        Yottaampere,
-                       1e+24,
                        i18nc("electrical current unit symbol", "YA"),
                        i18nc("unit description in lists", "yottaamperes"),
                        i18nc("unit synonyms for matching user input", "yottaampere;yottaamperes;YA"),
@@ -31,7 +30,6 @@ UnitCategory ElectricalCurrent::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ElectricalCurrentCategory,
                        Zettaampere,
-                       1e+21,
                        i18nc("electrical current unit symbol", "ZA"),
                        i18nc("unit description in lists", "zettaamperes"),
                        i18nc("unit synonyms for matching user input", "zettaampere;zettaamperes;ZA"),
@@ -41,7 +39,6 @@ UnitCategory ElectricalCurrent::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ElectricalCurrentCategory,
                        Exaampere,
-                       1e+18,
                        i18nc("electrical current unit symbol", "EA"),
                        i18nc("unit description in lists", "exaamperes"),
                        i18nc("unit synonyms for matching user input", "exaampere;exaamperes;EA"),
@@ -51,7 +48,6 @@ UnitCategory ElectricalCurrent::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ElectricalCurrentCategory,
                        Petaampere,
-                       1e+15,
                        i18nc("electrical current unit symbol", "PA"),
                        i18nc("unit description in lists", "petaamperes"),
                        i18nc("unit synonyms for matching user input", "petaampere;petaamperes;PA"),
@@ -61,7 +57,6 @@ UnitCategory ElectricalCurrent::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ElectricalCurrentCategory,
                        Teraampere,
-                       1e+12,
                        i18nc("electrical current unit symbol", "TA"),
                        i18nc("unit description in lists", "teraamperes"),
                        i18nc("unit synonyms for matching user input", "teraampere;teraamperes;TA"),
@@ -71,7 +66,6 @@ UnitCategory ElectricalCurrent::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(ElectricalCurrentCategory,
                              Gigaampere,
-                             1e+09,
                              i18nc("electrical current unit symbol", "GA"),
                              i18nc("unit description in lists", "gigaamperes"),
                              i18nc("unit synonyms for matching user input", "gigaampere;gigaamperes;GA"),
@@ -81,7 +75,6 @@ UnitCategory ElectricalCurrent::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(ElectricalCurrentCategory,
                              Megaampere,
-                             1e+06,
                              i18nc("electrical current unit symbol", "MA"),
                              i18nc("unit description in lists", "megaamperes"),
                              i18nc("unit synonyms for matching user input", "megaampere;megaamperes;MA"),
@@ -91,7 +84,6 @@ UnitCategory ElectricalCurrent::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(ElectricalCurrentCategory,
                              Kiloampere,
-                             1000,
                              i18nc("electrical current unit symbol", "kA"),
                              i18nc("unit description in lists", "kiloamperes"),
                              i18nc("unit synonyms for matching user input", "kiloampere;kiloamperes;kA"),
@@ -101,7 +93,6 @@ UnitCategory ElectricalCurrent::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ElectricalCurrentCategory,
                        Hectoampere,
-                       100,
                        i18nc("electrical current unit symbol", "hA"),
                        i18nc("unit description in lists", "hectoamperes"),
                        i18nc("unit synonyms for matching user input", "hectoampere;hectoamperes;hA"),
@@ -111,7 +102,6 @@ UnitCategory ElectricalCurrent::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ElectricalCurrentCategory,
                        Decaampere,
-                       10,
                        i18nc("electrical current unit symbol", "daA"),
                        i18nc("unit description in lists", "decaamperes"),
                        i18nc("unit synonyms for matching user input", "decaampere;decaamperes;daA"),
@@ -121,7 +111,6 @@ UnitCategory ElectricalCurrent::makeCategory()
 
     d->addDefaultUnit(UnitPrivate::makeUnit(ElectricalCurrentCategory,
                               Ampere,
-                              1,
                               i18nc("electrical current unit symbol", "A"),
                               i18nc("unit description in lists", "amperes"),
                               i18nc("unit synonyms for matching user input", "amp;amps;ampere;amperes;A"),
@@ -131,7 +120,6 @@ UnitCategory ElectricalCurrent::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ElectricalCurrentCategory,
                        Deciampere,
-                       0.1,
                        i18nc("electrical current unit symbol", "dA"),
                        i18nc("unit description in lists", "deciamperes"),
                        i18nc("unit synonyms for matching user input", "deciampere;deciamperes;dA"),
@@ -141,7 +129,6 @@ UnitCategory ElectricalCurrent::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ElectricalCurrentCategory,
                        Centiampere,
-                       0.01,
                        i18nc("electrical current unit symbol", "cA"),
                        i18nc("unit description in lists", "centiamperes"),
                        i18nc("unit synonyms for matching user input", "centiampere;centiamperes;cA"),
@@ -151,7 +138,6 @@ UnitCategory ElectricalCurrent::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ElectricalCurrentCategory,
                        Milliampere,
-                       0.001,
                        i18nc("electrical current unit symbol", "mA"),
                        i18nc("unit description in lists", "milliamperes"),
                        i18nc("unit synonyms for matching user input", "milliamp;milliamps;milliampere;milliamperes;mA"),
@@ -161,7 +147,6 @@ UnitCategory ElectricalCurrent::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ElectricalCurrentCategory,
                        Microampere,
-                       1e-06,
                        i18nc("electrical current unit symbol", "µA"),
                        i18nc("unit description in lists", "microamperes"),
                        i18nc("unit synonyms for matching user input", "microamp;microamps;microampere;microamperes;µA;uA"),
@@ -171,7 +156,6 @@ UnitCategory ElectricalCurrent::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ElectricalCurrentCategory,
                        Nanoampere,
-                       1e-09,
                        i18nc("electrical current unit symbol", "nA"),
                        i18nc("unit description in lists", "nanoamperes"),
                        i18nc("unit synonyms for matching user input", "nanoamp;nanoamps;nanoampere;nanoamperes;nA"),
@@ -181,7 +165,6 @@ UnitCategory ElectricalCurrent::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ElectricalCurrentCategory,
                        Picoampere,
-                       1e-12,
                        i18nc("electrical current unit symbol", "pA"),
                        i18nc("unit description in lists", "picoamperes"),
                        i18nc("unit synonyms for matching user input", "picoamp;picoamps;picoampere;picoamperes;pA"),
@@ -191,7 +174,6 @@ UnitCategory ElectricalCurrent::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ElectricalCurrentCategory,
                        Femtoampere,
-                       1e-15,
                        i18nc("electrical current unit symbol", "fA"),
                        i18nc("unit description in lists", "femtoamperes"),
                        i18nc("unit synonyms for matching user input", "femtoampere;femtoamperes;fA"),
@@ -201,7 +183,6 @@ UnitCategory ElectricalCurrent::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ElectricalCurrentCategory,
                        Attoampere,
-                       1e-18,
                        i18nc("electrical current unit symbol", "aA"),
                        i18nc("unit description in lists", "attoamperes"),
                        i18nc("unit synonyms for matching user input", "attoampere;attoamperes;aA"),
@@ -211,7 +192,6 @@ UnitCategory ElectricalCurrent::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ElectricalCurrentCategory,
                        Zeptoampere,
-                       1e-21,
                        i18nc("electrical current unit symbol", "zA"),
                        i18nc("unit description in lists", "zeptoamperes"),
                        i18nc("unit synonyms for matching user input", "zeptoampere;zeptoamperes;zA"),
@@ -221,7 +201,6 @@ UnitCategory ElectricalCurrent::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ElectricalCurrentCategory,
                        Yoctoampere,
-                       1e-24,
                        i18nc("electrical current unit symbol", "yA"),
                        i18nc("unit description in lists", "yoctoamperes"),
                        i18nc("unit synonyms for matching user input", "yoctoampere;yoctoamperes;yA"),
@@ -21,7 +21,6 @@ UnitCategory ElectricalResistance::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ElectricalResistanceCategory,
                        Yottaohms,
-                       1e+24,
                        i18nc("electrical resistance unit symbol", "YΩ"),
                        i18nc("unit description in lists", "yottaohms"),
                        i18nc("unit synonyms for matching user input", "yottaohm;yottaohms;YΩ"),
@@ -31,7 +30,6 @@ UnitCategory ElectricalResistance::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ElectricalResistanceCategory,
                        Zettaohms,
-                       1e+21,
                        i18nc("electrical resistance unit symbol", "ZΩ"),
                        i18nc("unit description in lists", "zettaohms"),
                        i18nc("unit synonyms for matching user input", "zettaohm;zettaohms;ZΩ"),
@@ -41,7 +39,6 @@ UnitCategory ElectricalResistance::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ElectricalResistanceCategory,
                        Exaohms,
-                       1e+18,
                        i18nc("electrical resistance unit symbol", "EΩ"),
                        i18nc("unit description in lists", "exaohms"),
                        i18nc("unit synonyms for matching user input", "exaohm;exaohms;EΩ"),
@@ -51,7 +48,6 @@ UnitCategory ElectricalResistance::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ElectricalResistanceCategory,
                        Petaohms,
-                       1e+15,
                        i18nc("electrical resistance unit symbol", "PΩ"),
                        i18nc("unit description in lists", "petaohms"),
                        i18nc("unit synonyms for matching user input", "petaohm;petaohms;PΩ"),
@@ -61,7 +57,6 @@ UnitCategory ElectricalResistance::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ElectricalResistanceCategory,
                        Teraohms,
-                       1e+12,
                        i18nc("electrical resistance unit symbol", "TΩ"),
                        i18nc("unit description in lists", "teraohms"),
                        i18nc("unit synonyms for matching user input", "teraohm;teraohms;TΩ"),
@@ -71,7 +66,6 @@ UnitCategory ElectricalResistance::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(ElectricalResistanceCategory,
                              Gigaohms,
-                             1e+09,
                              i18nc("electrical resistance unit symbol", "GΩ"),
                              i18nc("unit description in lists", "gigaohms"),
                              i18nc("unit synonyms for matching user input", "gigaohm;gigaohms;GΩ"),
@@ -81,7 +75,6 @@ UnitCategory ElectricalResistance::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(ElectricalResistanceCategory,
                              Megaohms,
-                             1e+06,
                              i18nc("electrical resistance unit symbol", "MΩ"),
                              i18nc("unit description in lists", "megaohms"),
                              i18nc("unit synonyms for matching user input", "megaohm;megaohms;MΩ"),
@@ -91,7 +84,6 @@ UnitCategory ElectricalResistance::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(ElectricalResistanceCategory,
                              Kiloohms,
-                             1000,
                              i18nc("electrical resistance unit symbol", "kΩ"),
                              i18nc("unit description in lists", "kiloohms"),
                              i18nc("unit synonyms for matching user input", "kiloohm;kiloohms;kΩ"),
@@ -101,7 +93,6 @@ UnitCategory ElectricalResistance::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ElectricalResistanceCategory,
                        Hectoohms,
-                       100,
                        i18nc("electrical resistance unit symbol", "hΩ"),
                        i18nc("unit description in lists", "hectoohms"),
                        i18nc("unit synonyms for matching user input", "hectoohm;hectoohms;hΩ"),
@@ -111,7 +102,6 @@ UnitCategory ElectricalResistance::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ElectricalResistanceCategory,
                        Decaohms,
-                       10,
                        i18nc("electrical resistance unit symbol", "daΩ"),
                        i18nc("unit description in lists", "decaohms"),
                        i18nc("unit synonyms for matching user input", "decaohm;decaohms;daΩ"),
@@ -121,7 +111,6 @@ UnitCategory ElectricalResistance::makeCategory()
 
     d->addDefaultUnit(UnitPrivate::makeUnit(ElectricalResistanceCategory,
                               Ohms,
-                              1,
                               i18nc("electrical resistance unit symbol", "Ω"),
                               i18nc("unit description in lists", "ohms"),
                               i18nc("unit synonyms for matching user input", "ohm;ohms;Ω"),
@@ -131,7 +120,6 @@ UnitCategory ElectricalResistance::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ElectricalResistanceCategory,
                        Deciohms,
-                       0.1,
                        i18nc("electrical resistance unit symbol", "dΩ"),
                        i18nc("unit description in lists", "deciohms"),
                        i18nc("unit synonyms for matching user input", "deciohm;deciohms;dΩ"),
@@ -141,7 +129,6 @@ UnitCategory ElectricalResistance::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ElectricalResistanceCategory,
                        Centiohms,
-                       0.01,
                        i18nc("electrical resistance unit symbol", "cΩ"),
                        i18nc("unit description in lists", "centiohms"),
                        i18nc("unit synonyms for matching user input", "centiohm;centiohms;cΩ"),
@@ -151,7 +138,6 @@ UnitCategory ElectricalResistance::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ElectricalResistanceCategory,
                        Milliohms,
-                       0.001,
                        i18nc("electrical resistance unit symbol", "mΩ"),
                        i18nc("unit description in lists", "milliohms"),
                        i18nc("unit synonyms for matching user input", "milliohm;milliohms;mΩ"),
@@ -161,7 +147,6 @@ UnitCategory ElectricalResistance::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ElectricalResistanceCategory,
                        Microohms,
-                       1e-06,
                        i18nc("electrical resistance unit symbol", "µΩ"),
                        i18nc("unit description in lists", "microohms"),
                        i18nc("unit synonyms for matching user input", "microohm;microohms;µΩ;uΩ"),
@@ -171,7 +156,6 @@ UnitCategory ElectricalResistance::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ElectricalResistanceCategory,
                        Nanoohms,
-                       1e-09,
                        i18nc("electrical resistance unit symbol", "nΩ"),
                        i18nc("unit description in lists", "nanoohms"),
                        i18nc("unit synonyms for matching user input", "nanoohm;nanoohms;nΩ"),
@@ -181,7 +165,6 @@ UnitCategory ElectricalResistance::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ElectricalResistanceCategory,
                        Picoohms,
-                       1e-12,
                        i18nc("electrical resistance unit symbol", "pΩ"),
                        i18nc("unit description in lists", "picoohms"),
                        i18nc("unit synonyms for matching user input", "picoohm;picoohms;pΩ"),
@@ -191,7 +174,6 @@ UnitCategory ElectricalResistance::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ElectricalResistanceCategory,
                        Femtoohms,
-                       1e-15,
                        i18nc("electrical resistance unit symbol", "fΩ"),
                        i18nc("unit description in lists", "femtoohms"),
                        i18nc("unit synonyms for matching user input", "femtoohm;femtoohms;fΩ"),
@@ -201,7 +183,6 @@ UnitCategory ElectricalResistance::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ElectricalResistanceCategory,
                        Attoohms,
-                       1e-18,
                        i18nc("electrical resistance unit symbol", "aΩ"),
                        i18nc("unit description in lists", "attoohms"),
                        i18nc("unit synonyms for matching user input", "attoohm;attoohms;aΩ"),
@@ -211,7 +192,6 @@ UnitCategory ElectricalResistance::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ElectricalResistanceCategory,
                        Zeptoohms,
-                       1e-21,
                        i18nc("electrical resistance unit symbol", "zΩ"),
                        i18nc("unit description in lists", "zeptoohms"),
                        i18nc("unit synonyms for matching user input", "zeptoohm;zeptoohms;zΩ"),
@@ -221,7 +201,6 @@ UnitCategory ElectricalResistance::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ElectricalResistanceCategory,
                        Yoctoohms,
-                       1e-24,
                        i18nc("electrical resistance unit symbol", "yΩ"),
                        i18nc("unit description in lists", "yoctoohms"),
                        i18nc("unit synonyms for matching user input", "yoctoohm;yoctoohms;yΩ"),
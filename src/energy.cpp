@@ -12,33 +12,6 @@
 
 namespace KUnitConversion
 {
-class PhotoUnitPrivate : public UnitPrivate
-{
-public:
-    PhotoUnitPrivate(CategoryId categoryId,
-                     UnitId id,
-                     qreal multiplier,
-                     const QString &symbol,
-                     const QString &description,
-                     const QString &matchString,
-                     const KLocalizedString &symbolString,
-                     const KLocalizedString &realString,
-                     const KLocalizedString &integerString)
-        : UnitPrivate(categoryId, id, multiplier, symbol, description, matchString, symbolString, realString, integerString)
-    {
-    }
-
-    qreal toDefault(qreal value) const override
-    {
-        return (2.99792458e+08 * 6.62606896e-34) / (value * 1e-09);
-    }
-
-    qreal fromDefault(qreal value) const override
-    {
-        return ((2.99792458e+08 * 6.62606896e-34) / value) / 1e-09;
-    }
-};
-
 UnitCategory Energy::makeCategory()
 {
     auto c = UnitCategoryPrivate::makeCategory(EnergyCategory, i18n("Energy"), i18n("Energy"));
@@ -47,7 +20,6 @@ UnitCategory Energy::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(EnergyCategory,
                        Yottajoule,
-                       1e+24,
                        i18nc("energy unit symbol", "YJ"),
                        i18nc("unit description in lists", "yottajoules"),
                        i18nc("unit synonyms for matching user input", "yottajoule;yottajoules;YJ"),
@@ -57,7 +29,6 @@ UnitCategory Energy::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(EnergyCategory,
                        Zettajoule,
-                       1e+21,
                        i18nc("energy unit symbol", "ZJ"),
                        i18nc("unit description in lists", "zettajoules"),
                        i18nc("unit synonyms for matching user input", "zettajoule;zettajoules;ZJ"),
@@ -67,7 +38,6 @@ UnitCategory Energy::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(EnergyCategory,
                        Exajoule,
-                       1e+18,
                        i18nc("energy unit symbol", "EJ"),
                        i18nc("unit description in lists", "exajoules"),
                        i18nc("unit synonyms for matching user input", "exajoule;exajoules;EJ"),
@@ -77,7 +47,6 @@ UnitCategory Energy::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(EnergyCategory,
                        Petajoule,
-                       1e+15,
                        i18nc("energy unit symbol", "PJ"),
                        i18nc("unit description in lists", "petajoules"),
                        i18nc("unit synonyms for matching user input", "petajoule;petajoules;PJ"),
@@ -87,7 +56,6 @@ UnitCategory Energy::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(EnergyCategory,
                        Terajoule,
-                       1e+12,
                        i18nc("energy unit symbol", "TJ"),
                        i18nc("unit description in lists", "terajoules"),
                        i18nc("unit synonyms for matching user input", "terajoule;terajoules;TJ"),
@@ -97,7 +65,6 @@ UnitCategory Energy::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(EnergyCategory,
                        Gigajoule,
-                       1e+09,
                        i18nc("energy unit symbol", "GJ"),
                        i18nc("unit description in lists", "gigajoules"),
                        i18nc("unit synonyms for matching user input", "gigajoule;gigajoules;GJ"),
@@ -107,7 +74,6 @@ UnitCategory Energy::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(EnergyCategory,
                        Megajoule,
-                       1e+06,
                        i18nc("energy unit symbol", "MJ"),
                        i18nc("unit description in lists", "megajoules"),
                        i18nc("unit synonyms for matching user input", "megajoule;megajoules;MJ"),
@@ -117,7 +83,6 @@ UnitCategory Energy::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(EnergyCategory,
                              Kilojoule,
-                             1000,
                              i18nc("energy unit symbol", "kJ"),
                              i18nc("unit description in lists", "kilojoules"),
                              i18nc("unit synonyms for matching user input", "kilojoule;kilojoules;kJ"),
@@ -127,7 +92,6 @@ UnitCategory Energy::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(EnergyCategory,
                        Hectojoule,
-                       100,
                        i18nc("energy unit symbol", "hJ"),
                        i18nc("unit description in lists", "hectojoules"),
                        i18nc("unit synonyms for matching user input", "hectojoule;hectojoules;hJ"),
@@ -137,7 +101,6 @@ UnitCategory Energy::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(EnergyCategory,
                        Decajoule,
-                       10,
                        i18nc("energy unit symbol", "daJ"),
                        i18nc("unit description in lists", "decajoules"),
                        i18nc("unit synonyms for matching user input", "decajoule;decajoules;daJ"),
@@ -147,7 +110,6 @@ UnitCategory Energy::makeCategory()
 
     d->addDefaultUnit(UnitPrivate::makeUnit(EnergyCategory,
                               Joule,
-                              1,
                               i18nc("energy unit symbol", "J"),
                               i18nc("unit description in lists", "joules"),
                               i18nc("unit synonyms for matching user input", "joule;joules;J"),
@@ -157,7 +119,6 @@ UnitCategory Energy::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(EnergyCategory,
                        Decijoule,
-                       0.1,
                        i18nc("energy unit symbol", "dJ"),
                        i18nc("unit description in lists", "decijoules"),
                        i18nc("unit synonyms for matching user input", "decijoule;decijoules;dJ"),
@@ -167,7 +128,6 @@ UnitCategory Energy::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(EnergyCategory,
                        Centijoule,
-                       0.01,
                        i18nc("energy unit symbol", "cJ"),
                        i18nc("unit description in lists", "centijoules"),
                        i18nc("unit synonyms for matching user input", "centijoule;centijoules;cJ"),
@@ -177,7 +137,6 @@ UnitCategory Energy::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(EnergyCategory,
                        Millijoule,
-                       0.001,
                        i18nc("energy unit symbol", "mJ"),
                        i18nc("unit description in lists", "millijoules"),
                        i18nc("unit synonyms for matching user input", "millijoule;millijoules;mJ"),
@@ -187,7 +146,6 @@ UnitCategory Energy::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(EnergyCategory,
                        Microjoule,
-                       1e-06,
                        i18nc("energy unit symbol", "µJ"),
                        i18nc("unit description in lists", "microjoules"),
                        i18nc("unit synonyms for matching user input", "microjoule;microjoules;µJ;uJ"),
@@ -197,7 +155,6 @@ UnitCategory Energy::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(EnergyCategory,
                        Nanojoule,
-                       1e-09,
                        i18nc("energy unit symbol", "nJ"),
                        i18nc("unit description in lists", "nanojoules"),
                        i18nc("unit synonyms for matching user input", "nanojoule;nanojoules;nJ"),
@@ -207,7 +164,6 @@ UnitCategory Energy::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(EnergyCategory,
                        Picojoule,
-                       1e-12,
                        i18nc("energy unit symbol", "pJ"),
                        i18nc("unit description in lists", "picojoules"),
                        i18nc("unit synonyms for matching user input", "picojoule;picojoules;pJ"),
@@ -217,7 +173,6 @@ UnitCategory Energy::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(EnergyCategory,
                        Femtojoule,
-                       1e-15,
                        i18nc("energy unit symbol", "fJ"),
                        i18nc("unit description in lists", "femtojoules"),
                        i18nc("unit synonyms for matching user input", "femtojoule;femtojoules;fJ"),
@@ -227,7 +182,6 @@ UnitCategory Energy::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(EnergyCategory,
                        Attojoule,
-                       1e-18,
                        i18nc("energy unit symbol", "aJ"),
                        i18nc("unit description in lists", "attojoules"),
                        i18nc("unit synonyms for matching user input", "attojoule;attojoules;aJ"),
@@ -237,7 +191,6 @@ UnitCategory Energy::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(EnergyCategory,
                        Zeptojoule,
-                       1e-21,
                        i18nc("energy unit symbol", "zJ"),
                        i18nc("unit description in lists", "zeptojoules"),
                        i18nc("unit synonyms for matching user input", "zeptojoule;zeptojoules;zJ"),
@@ -247,7 +200,6 @@ UnitCategory Energy::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(EnergyCategory,
                        Yoctojoule,
-                       1e-24,
                        i18nc("energy unit symbol", "yJ"),
                        i18nc("unit description in lists", "yoctojoules"),
                        i18nc("unit synonyms for matching user input", "yoctojoule;yoctojoules;yJ"),
@@ -257,7 +209,6 @@ UnitCategory Energy::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(EnergyCategory,
                              GuidelineDailyAmount,
-                             8.3736e+06,
                              i18nc("energy unit symbol", "GDA"),
                              i18nc("unit description in lists", "guideline daily amount"),
                              i18nc("unit synonyms for matching user input", "guideline daily amount;guideline daily amount;GDA"),
@@ -267,7 +218,6 @@ UnitCategory Energy::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(EnergyCategory,
                        Electronvolt,
-                       1.60218e-19,
                        i18nc("energy unit symbol", "eV"),
                        i18nc("unit description in lists", "electronvolts"),
                        i18nc("unit synonyms for matching user input", "electronvolt;electronvolts;eV"),
@@ -277,7 +227,6 @@ UnitCategory Energy::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(EnergyCategory,
                        JoulePerMole,
-                       1.66054238581e-24,
                        i18nc("energy unit symbol", "J/mol"),
                        i18nc("unit description in lists", "joule per mole"),
                        i18nc("unit synonyms for matching user input", "joule per mole;joulepermole;joulemol;jmol;j/mol"),
@@ -287,7 +236,6 @@ UnitCategory Energy::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(EnergyCategory,
                        KiloJoulePerMole,
-                       1.66054238581e-21,
                        i18nc("energy unit symbol", "kJ/mol"),
                        i18nc("unit description in lists", "kilojoule per mole"),
                        i18nc("unit synonyms for matching user input", "kilojoule per mole;kilojoulepermole;kilojoule per mole;kilojoulemol;kjmol;kj/mol"),
@@ -297,7 +245,6 @@ UnitCategory Energy::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(EnergyCategory,
                        Rydberg,
-                       2.17987e-18,
                        i18nc("energy unit symbol", "Ry"),
                        i18nc("unit description in lists", "rydbergs"),
                        i18nc("unit synonyms for matching user input", "rydberg;rydbergs;Ry"),
@@ -307,7 +254,6 @@ UnitCategory Energy::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(EnergyCategory,
                              Kilocalorie,
-                             4186.8,
                              i18nc("energy unit symbol", "kcal"),
                              i18nc("unit description in lists", "kilocalories"),
                              i18nc("unit synonyms for matching user input", "kilocalorie;kilocalories;kcal"),
@@ -317,7 +263,6 @@ UnitCategory Energy::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(EnergyCategory,
                              Btu,
-                             1055.05585,
                              i18nc("energy unit symbol", "BTU"),
                              i18nc("unit description in lists", "British Thermal Unit"),
                              i18nc("unit synonyms for matching user input", "Btu;BTU;Btus;BTUs"),
@@ -327,7 +272,6 @@ UnitCategory Energy::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(EnergyCategory,
                              Erg,
-                             1.0e-7,
                              i18nc("energy unit symbol", "Erg"),
                              i18nc("unit description in lists", "ergs"),
                              i18nc("unit synonyms for matching user input", "Erg;erg;Ergs;ergs"),
@@ -335,20 +279,18 @@ UnitCategory Energy::makeCategory()
                              ki18nc("amount in units (real)", "%1 ergs"),
                              ki18ncp("amount in units (integer)", "%1 erg", "%1 erg")));
 
-    d->addUnit(UnitPrivate::makeUnit(new PhotoUnitPrivate(EnergyCategory,
-                                            PhotonWavelength,
-                                            1.0,
-                                            i18nc("energy unit symbol", "nm"),
-                                            i18nc("unit description in lists", "photon wavelength in nanometers"),
-                                            i18nc("unit synonyms for matching user input", "nm;photon wavelength"),
-                                            symbolString,
-                                            ki18nc("amount in units (real)", "%1 nanometers"),
-                                            ki18ncp("amount in units (integer)", "%1 nanometer", "%1 nanometers"))));
+    d->addUnit(UnitPrivate::makeUnit(EnergyCategory,
+                                     PhotonWavelength,
+                                     i18nc("energy unit symbol", "nm"),
+                                     i18nc("unit description in lists", "photon wavelength in nanometers"),
+                                     i18nc("unit synonyms for matching user input", "nm;photon wavelength"),
+                                     symbolString,
+                                     ki18nc("amount in units (real)", "%1 nanometers"),
+                                     ki18ncp("amount in units (integer)", "%1 nanometer", "%1 nanometers")));
 
     // https://en.wikipedia.org/wiki/Kilowatt-hour
     d->addUnit(UnitPrivate::makeUnit(EnergyCategory,
                                      TeraWattHour,
-                                     1e+12 * 60 * 60,
                                      i18nc("energy unit symbol", "TW⋅h"),
                                      i18nc("unit description in lists", "terawatt-hour"),
                                      i18nc("unit synonyms for matching user input", "terawattHour;terawatt Hour;TWh;Twh;TW⋅h"),
@@ -358,7 +300,6 @@ UnitCategory Energy::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(EnergyCategory,
                                      GigaWattHour,
-                                     1e+09 * 60 * 60,
                                      i18nc("energy unit symbol", "GW⋅h"),
                                      i18nc("unit description in lists", "gigawatt-hour"),
                                      i18nc("unit synonyms for matching user input", "gigawattHour;gegawatt Hour;GWh;Gwh;GW⋅h"),
@@ -368,7 +309,6 @@ UnitCategory Energy::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(EnergyCategory,
                                      MegaWattHour,
-                                     1e+06 * 60 * 60,
                                      i18nc("energy unit symbol", "MW⋅h"),
                                      i18nc("unit description in lists", "megawatt-hour"),
                                      i18nc("unit synonyms for matching user input", "megawattHour;megawatt Hour;MWh;Mwh;MW⋅h"),
@@ -378,7 +318,6 @@ UnitCategory Energy::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(EnergyCategory,
                                      KiloWattHour,
-                                     1000 * 60 * 60,
                                      i18nc("energy unit symbol", "kW⋅h"),
                                      i18nc("unit description in lists", "kilowatt-hour"),
                                      i18nc("unit synonyms for matching user input", "kilowattHour;kilowatt Hour;kWh;kwh;kW⋅h"),
@@ -388,7 +327,6 @@ UnitCategory Energy::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(EnergyCategory,
                                      WattHour,
-                                     60 * 60,
                                      i18nc("energy unit symbol", "W⋅h"),
                                      i18nc("unit description in lists", "watt-hour"),
                                      i18nc("unit synonyms for matching user input", "wattHour;watt Hour;Wh;wh;W⋅h"),
@@ -20,7 +20,6 @@ UnitCategory Force::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ForceCategory,
                        Yottanewton,
-                       1e+24,
                        i18nc("force unit symbol", "YN"),
                        i18nc("unit description in lists", "yottanewtons"),
                        i18nc("unit synonyms for matching user input", "yottanewton;yottanewtons;YN"),
@@ -30,7 +29,6 @@ UnitCategory Force::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ForceCategory,
                        Zettanewton,
-                       1e+21,
                        i18nc("force unit symbol", "ZN"),
                        i18nc("unit description in lists", "zettanewtons"),
                        i18nc("unit synonyms for matching user input", "zettanewton;zettanewtons;ZN"),
@@ -40,7 +38,6 @@ UnitCategory Force::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ForceCategory,
                        Exanewton,
-                       1e+18,
                        i18nc("force unit symbol", "EN"),
                        i18nc("unit description in lists", "exanewtons"),
                        i18nc("unit synonyms for matching user input", "exanewton;exanewtons;EN"),
@@ -50,7 +47,6 @@ UnitCategory Force::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ForceCategory,
                        Petanewton,
-                       1e+15,
                        i18nc("force unit symbol", "PN"),
                        i18nc("unit description in lists", "petanewtons"),
                        i18nc("unit synonyms for matching user input", "petanewton;petanewtons;PN"),
@@ -60,7 +56,6 @@ UnitCategory Force::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ForceCategory,
                        Teranewton,
-                       1e+12,
                        i18nc("force unit symbol", "TN"),
                        i18nc("unit description in lists", "teranewtons"),
                        i18nc("unit synonyms for matching user input", "teranewton;teranewtons;TN"),
@@ -70,7 +65,6 @@ UnitCategory Force::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ForceCategory,
                        Giganewton,
-                       1e+09,
                        i18nc("force unit symbol", "GN"),
                        i18nc("unit description in lists", "giganewtons"),
                        i18nc("unit synonyms for matching user input", "giganewton;giganewtons;GN"),
@@ -80,7 +74,6 @@ UnitCategory Force::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ForceCategory,
                        Meganewton,
-                       1e+06,
                        i18nc("force unit symbol", "MN"),
                        i18nc("unit description in lists", "meganewtons"),
                        i18nc("unit synonyms for matching user input", "meganewton;meganewtons;MN"),
@@ -90,7 +83,6 @@ UnitCategory Force::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(ForceCategory,
                              KilonewtonForce,
-                             1000,
                              i18nc("force unit symbol", "kN"),
                              i18nc("unit description in lists", "kilonewtons"),
                              i18nc("unit synonyms for matching user input", "kilonewton;kilonewtons;kN"),
@@ -100,7 +92,6 @@ UnitCategory Force::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ForceCategory,
                        Hectonewton,
-                       100,
                        i18nc("force unit symbol", "hN"),
                        i18nc("unit description in lists", "hectonewtons"),
                        i18nc("unit synonyms for matching user input", "hectonewton;hectonewtons;hN"),
@@ -110,7 +101,6 @@ UnitCategory Force::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ForceCategory,
                        Decanewton,
-                       10,
                        i18nc("force unit symbol", "daN"),
                        i18nc("unit description in lists", "decanewtons"),
                        i18nc("unit synonyms for matching user input", "decanewton;decanewtons;daN"),
@@ -120,7 +110,6 @@ UnitCategory Force::makeCategory()
 
     d->addDefaultUnit(UnitPrivate::makeUnit(ForceCategory,
                               Newton,
-                              1,
                               i18nc("force unit symbol", "N"),
                               i18nc("unit description in lists", "newtons"),
                               i18nc("unit synonyms for matching user input", "newton;newtons;N"),
@@ -130,7 +119,6 @@ UnitCategory Force::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ForceCategory,
                        Decinewton,
-                       0.1,
                        i18nc("force unit symbol", "dN"),
                        i18nc("unit description in lists", "decinewtons"),
                        i18nc("unit synonyms for matching user input", "decinewton;decinewtons;dN"),
@@ -140,7 +128,6 @@ UnitCategory Force::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ForceCategory,
                        Centinewton,
-                       0.01,
                        i18nc("force unit symbol", "cN"),
                        i18nc("unit description in lists", "centinewtons"),
                        i18nc("unit synonyms for matching user input", "centinewton;centinewtons;cN"),
@@ -150,7 +137,6 @@ UnitCategory Force::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ForceCategory,
                        Millinewton,
-                       0.001,
                        i18nc("force unit symbol", "mN"),
                        i18nc("unit description in lists", "millinewtons"),
                        i18nc("unit synonyms for matching user input", "millinewton;millinewtons;mN"),
@@ -160,7 +146,6 @@ UnitCategory Force::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ForceCategory,
                        Micronewton,
-                       1e-06,
                        i18nc("force unit symbol", "µN"),
                        i18nc("unit description in lists", "micronewtons"),
                        i18nc("unit synonyms for matching user input", "micronewton;micronewtons;µm;uN"),
@@ -170,7 +155,6 @@ UnitCategory Force::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ForceCategory,
                        Nanonewton,
-                       1e-09,
                        i18nc("force unit symbol", "nN"),
                        i18nc("unit description in lists", "nanonewtons"),
                        i18nc("unit synonyms for matching user input", "nanonewton;nanonewtons;nN"),
@@ -180,7 +164,6 @@ UnitCategory Force::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ForceCategory,
                        Piconewton,
-                       1e-12,
                        i18nc("force unit symbol", "pN"),
                        i18nc("unit description in lists", "piconewtons"),
                        i18nc("unit synonyms for matching user input", "piconewton;piconewtons;pN"),
@@ -190,7 +173,6 @@ UnitCategory Force::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ForceCategory,
                        Femtonewton,
-                       1e-15,
                        i18nc("force unit symbol", "fN"),
                        i18nc("unit description in lists", "femtonewtons"),
                        i18nc("unit synonyms for matching user input", "femtonewton;femtonewtons;fN"),
@@ -200,7 +182,6 @@ UnitCategory Force::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ForceCategory,
                        Attonewton,
-                       1e-18,
                        i18nc("force unit symbol", "aN"),
                        i18nc("unit description in lists", "attonewtons"),
                        i18nc("unit synonyms for matching user input", "attonewton;attonewtons;aN"),
@@ -210,7 +191,6 @@ UnitCategory Force::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ForceCategory,
                        Zeptonewton,
-                       1e-21,
                        i18nc("force unit symbol", "zN"),
                        i18nc("unit description in lists", "zeptonewtons"),
                        i18nc("unit synonyms for matching user input", "zeptonewton;zeptonewtons;zN"),
@@ -220,7 +200,6 @@ UnitCategory Force::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ForceCategory,
                        Yoctonewton,
-                       1e-24,
                        i18nc("force unit symbol", "yN"),
                        i18nc("unit description in lists", "yoctonewtons"),
                        i18nc("unit synonyms for matching user input", "yoctonewton;yoctonewtons;yN"),
@@ -231,7 +210,6 @@ UnitCategory Force::makeCategory()
     // http://en.wikipedia.org/wiki/Force#Units_of_measurement
     d->addUnit(UnitPrivate::makeUnit(ForceCategory,
                        Dyne,
-                       0.0001,
                        i18nc("force unit symbol", "dyn"),
                        i18nc("unit description in lists", "dynes"),
                        i18nc("unit synonyms for matching user input", "dyne;dynes;dyn"),
@@ -241,7 +219,6 @@ UnitCategory Force::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ForceCategory,
                        Kilopond,
-                       9.80665,
                        i18nc("force unit symbol", "kp"),
                        i18nc("unit description in lists", "kiloponds"),
                        i18nc("unit synonyms for matching user input", "kilogram-force;kilopond;kiloponds;kp"),
@@ -251,7 +228,6 @@ UnitCategory Force::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ForceCategory,
                        PoundForce,
-                       4.448222,
                        i18nc("force unit symbol", "lbf"),
                        i18nc("unit description in lists", "pound-force"),
                        i18nc("unit synonyms for matching user input", "pound-force;lbf"),
@@ -261,7 +237,6 @@ UnitCategory Force::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(ForceCategory,
                        Poundal,
-                       0.138255,
                        i18nc("force unit symbol", "pdl"),
                        i18nc("unit description in lists", "poundals"),
                        i18nc("unit synonyms for matching user input", "poundal;poundals;pdl"),
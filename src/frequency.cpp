@@ -21,7 +21,6 @@ UnitCategory Frequency::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(FrequencyCategory,
                        Yottahertz,
-                       1e+24,
                        i18nc("frequency unit symbol", "YHz"),
                        i18nc("unit description in lists", "yottahertzs"),
                        i18nc("unit synonyms for matching user input", "yottahertz;yottahertzs;YHz"),
@@ -31,7 +30,6 @@ UnitCategory Frequency::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(FrequencyCategory,
                        Zettahertz,
-                       1e+21,
                        i18nc("frequency unit symbol", "ZHz"),
                        i18nc("unit description in lists", "zettahertzs"),
                        i18nc("unit synonyms for matching user input", "zettahertz;zettahertzs;ZHz"),
@@ -41,7 +39,6 @@ UnitCategory Frequency::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(FrequencyCategory,
                        Exahertz,
-                       1e+18,
                        i18nc("frequency unit symbol", "EHz"),
                        i18nc("unit description in lists", "exahertzs"),
                        i18nc("unit synonyms for matching user input", "exahertz;exahertzs;EHz"),
@@ -51,7 +48,6 @@ UnitCategory Frequency::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(FrequencyCategory,
                        Petahertz,
-                       1e+15,
                        i18nc("frequency unit symbol", "PHz"),
                        i18nc("unit description in lists", "petahertzs"),
                        i18nc("unit synonyms for matching user input", "petahertz;petahertzs;PHz"),
@@ -61,7 +57,6 @@ UnitCategory Frequency::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(FrequencyCategory,
                        Terahertz,
-                       1e+12,
                        i18nc("frequency unit symbol", "THz"),
                        i18nc("unit description in lists", "terahertzs"),
                        i18nc("unit synonyms for matching user input", "terahertz;terahertzs;THz"),
@@ -71,7 +66,6 @@ UnitCategory Frequency::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(FrequencyCategory,
                              Gigahertz,
-                             1e+09,
                              i18nc("frequency unit symbol", "GHz"),
                              i18nc("unit description in lists", "gigahertzs"),
                              i18nc("unit synonyms for matching user input", "gigahertz;gigahertzs;GHz"),
@@ -81,7 +75,6 @@ UnitCategory Frequency::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(FrequencyCategory,
                              Megahertz,
-                             1e+06,
                              i18nc("frequency unit symbol", "MHz"),
                              i18nc("unit description in lists", "megahertzs"),
                              i18nc("unit synonyms for matching user input", "megahertz;megahertzs;MHz"),
@@ -91,7 +84,6 @@ UnitCategory Frequency::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(FrequencyCategory,
                              Kilohertz,
-                             1000,
                              i18nc("frequency unit symbol", "kHz"),
                              i18nc("unit description in lists", "kilohertzs"),
                              i18nc("unit synonyms for matching user input", "kilohertz;kilohertzs;kHz"),
@@ -101,7 +93,6 @@ UnitCategory Frequency::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(FrequencyCategory,
                        Hectohertz,
-                       100,
                        i18nc("frequency unit symbol", "hHz"),
                        i18nc("unit description in lists", "hectohertzs"),
                        i18nc("unit synonyms for matching user input", "hectohertz;hectohertzs;hHz"),
@@ -111,7 +102,6 @@ UnitCategory Frequency::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(FrequencyCategory,
                        Decahertz,
-                       10,
                        i18nc("frequency unit symbol", "daHz"),
                        i18nc("unit description in lists", "decahertzs"),
                        i18nc("unit synonyms for matching user input", "decahertz;decahertzs;daHz"),
@@ -121,7 +111,6 @@ UnitCategory Frequency::makeCategory()
 
     d->addDefaultUnit(UnitPrivate::makeUnit(FrequencyCategory,
                               Hertz,
-                              1,
                               i18nc("frequency unit symbol", "Hz"),
                               i18nc("unit description in lists", "hertzs"),
                               i18nc("unit synonyms for matching user input", "hertz;hertzs;Hz"),
@@ -131,7 +120,6 @@ UnitCategory Frequency::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(FrequencyCategory,
                        Decihertz,
-                       0.1,
                        i18nc("frequency unit symbol", "dHz"),
                        i18nc("unit description in lists", "decihertzs"),
                        i18nc("unit synonyms for matching user input", "decihertz;decihertzs;dHz"),
@@ -141,7 +129,6 @@ UnitCategory Frequency::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(FrequencyCategory,
                        Centihertz,
-                       0.01,
                        i18nc("frequency unit symbol", "cHz"),
                        i18nc("unit description in lists", "centihertzs"),
                        i18nc("unit synonyms for matching user input", "centihertz;centihertzs;cHz"),
@@ -151,7 +138,6 @@ UnitCategory Frequency::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(FrequencyCategory,
                        Millihertz,
-                       0.001,
                        i18nc("frequency unit symbol", "mHz"),
                        i18nc("unit description in lists", "millihertzs"),
                        i18nc("unit synonyms for matching user input", "millihertz;millihertzs;mHz"),
@@ -161,7 +147,6 @@ UnitCategory Frequency::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(FrequencyCategory,
                        Microhertz,
-                       1e-06,
                        i18nc("frequency unit symbol", "µHz"),
                        i18nc("unit description in lists", "microhertzs"),
                        i18nc("unit synonyms for matching user input", "microhertz;microhertzs;µHz;uHz"),
@@ -171,7 +156,6 @@ UnitCategory Frequency::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(FrequencyCategory,
                        Nanohertz,
-                       1e-09,
                        i18nc("frequency unit symbol", "nHz"),
                        i18nc("unit description in lists", "nanohertzs"),
                        i18nc("unit synonyms for matching user input", "nanohertz;nanohertzs;nHz"),
@@ -181,7 +165,6 @@ UnitCategory Frequency::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(FrequencyCategory,
                        Picohertz,
-                       1e-12,
                        i18nc("frequency unit symbol", "pHz"),
                        i18nc("unit description in lists", "picohertzs"),
                        i18nc("unit synonyms for matching user input", "picohertz;picohertzs;pHz"),
@@ -191,7 +174,6 @@ UnitCategory Frequency::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(FrequencyCategory,
                        Femtohertz,
-                       1e-15,
                        i18nc("frequency unit symbol", "fHz"),
                        i18nc("unit description in lists", "femtohertzs"),
                        i18nc("unit synonyms for matching user input", "femtohertz;femtohertzs;fHz"),
@@ -201,7 +183,6 @@ UnitCategory Frequency::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(FrequencyCategory,
                        Attohertz,
-                       1e-18,
                        i18nc("frequency unit symbol", "aHz"),
                        i18nc("unit description in lists", "attohertzs"),
                        i18nc("unit synonyms for matching user input", "attohertz;attohertzs;aHz"),
@@ -211,7 +192,6 @@ UnitCategory Frequency::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(FrequencyCategory,
                        Zeptohertz,
-                       1e-21,
                        i18nc("frequency unit symbol", "zHz"),
                        i18nc("unit description in lists", "zeptohertzs"),
                        i18nc("unit synonyms for matching user input", "zeptohertz;zeptohertzs;zHz"),
@@ -221,7 +201,6 @@ UnitCategory Frequency::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(FrequencyCategory,
                        Yoctohertz,
-                       1e-24,
                        i18nc("frequency unit symbol", "yHz"),
                        i18nc("unit description in lists", "yoctohertzs"),
                        i18nc("unit synonyms for matching user input", "yoctohertz;yoctohertzs;yHz"),
@@ -231,7 +210,6 @@ UnitCategory Frequency::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(FrequencyCategory,
                              RPM,
-                             1.0 / 60.0,
                              i18nc("frequency unit symbol", "RPM"),
                              i18nc("unit description in lists", "revolutions per minute"),
                              i18nc("unit synonyms for matching user input", "revolutions per minute;revolution per minute;RPM"),
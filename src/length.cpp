@@ -21,7 +21,6 @@ UnitCategory Length::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(LengthCategory,
                        Yottameter,
-                       1e+24,
                        i18nc("length unit symbol", "Ym"),
                        i18nc("unit description in lists", "yottameters"),
                        i18nc("unit synonyms for matching user input", "yottameter;yottameters;Ym"),
@@ -31,7 +30,6 @@ UnitCategory Length::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(LengthCategory,
                        Zettameter,
-                       1e+21,
                        i18nc("length unit symbol", "Zm"),
                        i18nc("unit description in lists", "zettameters"),
                        i18nc("unit synonyms for matching user input", "zettameter;zettameters;Zm"),
@@ -41,7 +39,6 @@ UnitCategory Length::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(LengthCategory,
                        Exameter,
-                       1e+18,
                        i18nc("length unit symbol", "Em"),
                        i18nc("unit description in lists", "exameters"),
                        i18nc("unit synonyms for matching user input", "exameter;exameters;Em"),
@@ -51,7 +48,6 @@ UnitCategory Length::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(LengthCategory,
                        Petameter,
-                       1e+15,
                        i18nc("length unit symbol", "Pm"),
                        i18nc("unit description in lists", "petameters"),
                        i18nc("unit synonyms for matching user input", "petameter;petameters;Pm"),
@@ -61,7 +57,6 @@ UnitCategory Length::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(LengthCategory,
                        Terameter,
-                       1e+12,
                        i18nc("length unit symbol", "Tm"),
                        i18nc("unit description in lists", "terameters"),
                        i18nc("unit synonyms for matching user input", "terameter;terameters;Tm"),
@@ -71,7 +66,6 @@ UnitCategory Length::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(LengthCategory,
                        Gigameter,
-                       1e+09,
                        i18nc("length unit symbol", "Gm"),
                        i18nc("unit description in lists", "gigameters"),
                        i18nc("unit synonyms for matching user input", "gigameter;gigameters;Gm"),
@@ -81,7 +75,6 @@ UnitCategory Length::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(LengthCategory,
                        Megameter,
-                       1e+06,
                        i18nc("length unit symbol", "Mm"),
                        i18nc("unit description in lists", "megameters"),
                        i18nc("unit synonyms for matching user input", "megameter;megameters;Mm"),
@@ -91,7 +84,6 @@ UnitCategory Length::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(LengthCategory,
                              Kilometer,
-                             1000,
                              i18nc("length unit symbol", "km"),
                              i18nc("unit description in lists", "kilometers"),
                              i18nc("unit synonyms for matching user input", "kilometer;kilometers;km"),
@@ -101,7 +93,6 @@ UnitCategory Length::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(LengthCategory,
                        Hectometer,
-                       100,
                        i18nc("length unit symbol", "hm"),
                        i18nc("unit description in lists", "hectometers"),
                        i18nc("unit synonyms for matching user input", "hectometer;hectometers;hm"),
@@ -111,7 +102,6 @@ UnitCategory Length::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(LengthCategory,
                        Decameter,
-                       10,
                        i18nc("length unit symbol", "dam"),
                        i18nc("unit description in lists", "decameters"),
                        i18nc("unit synonyms for matching user input", "decameter;decameters;dam"),
@@ -121,7 +111,6 @@ UnitCategory Length::makeCategory()
 
     d->addDefaultUnit(UnitPrivate::makeUnit(LengthCategory,
                               Meter,
-                              1,
                               i18nc("length unit symbol", "m"),
                               i18nc("unit description in lists", "meters"),
                               i18nc("unit synonyms for matching user input", "meter;meters;m"),
@@ -131,7 +120,6 @@ UnitCategory Length::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(LengthCategory,
                        Decimeter,
-                       0.1,
                        i18nc("length unit symbol", "dm"),
                        i18nc("unit description in lists", "decimeters"),
                        i18nc("unit synonyms for matching user input", "decimeter;decimeters;dm"),
@@ -141,7 +129,6 @@ UnitCategory Length::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(LengthCategory,
                              Centimeter,
-                             0.01,
                              i18nc("length unit symbol", "cm"),
                              i18nc("unit description in lists", "centimeters"),
                              i18nc("unit synonyms for matching user input", "centimeter;centimeters;cm"),
@@ -151,7 +138,6 @@ UnitCategory Length::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(LengthCategory,
                              Millimeter,
-                             0.001,
                              i18nc("length unit symbol", "mm"),
                              i18nc("unit description in lists", "millimeters"),
                              i18nc("unit synonyms for matching user input", "millimeter;millimeters;mm"),
@@ -161,7 +147,6 @@ UnitCategory Length::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(LengthCategory,
                        Micrometer,
-                       1e-06,
                        i18nc("length unit symbol", "µm"),
                        i18nc("unit description in lists", "micrometers"),
                        i18nc("unit synonyms for matching user input", "micrometer;micrometers;µm;um"),
@@ -171,7 +156,6 @@ UnitCategory Length::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(LengthCategory,
                        Nanometer,
-                       1e-09,
                        i18nc("length unit symbol", "nm"),
                        i18nc("unit description in lists", "nanometers"),
                        i18nc("unit synonyms for matching user input", "nanometer;nanometers;nm"),
@@ -181,7 +165,6 @@ UnitCategory Length::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(LengthCategory,
                        Angstrom,
-                       1e-10,
                        i18nc("length unit symbol", "Å"),
                        i18nc("unit description in lists", "Ångström"),
                        i18nc("unit synonyms for matching user input", "Ångström;Ångstrom;Angström;Angstrom;Ångströms;Ångstroms;Angströms;Angstroms;Å"),
@@ -191,7 +174,6 @@ UnitCategory Length::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(LengthCategory,
                        Picometer,
-                       1e-12,
                        i18nc("length unit symbol", "pm"),
                        i18nc("unit description in lists", "picometers"),
                        i18nc("unit synonyms for matching user input", "picometer;picometers;pm"),
@@ -201,7 +183,6 @@ UnitCategory Length::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(LengthCategory,
                        Femtometer,
-                       1e-15,
                        i18nc("length unit symbol", "fm"),
                        i18nc("unit description in lists", "femtometers"),
                        i18nc("unit synonyms for matching user input", "femtometer;femtometers;fm"),
@@ -211,7 +192,6 @@ UnitCategory Length::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(LengthCategory,
                        Attometer,
-                       1e-18,
                        i18nc("length unit symbol", "am"),
                        i18nc("unit description in lists", "attometers"),
                        i18nc("unit synonyms for matching user input", "attometer;attometers;am"),
@@ -221,7 +201,6 @@ UnitCategory Length::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(LengthCategory,
                        Zeptometer,
-                       1e-21,
                        i18nc("length unit symbol", "zm"),
                        i18nc("unit description in lists", "zeptometers"),
                        i18nc("unit synonyms for matching user input", "zeptometer;zeptometers;zm"),
@@ -231,7 +210,6 @@ UnitCategory Length::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(LengthCategory,
                        Yoctometer,
-                       1e-24,
                        i18nc("length unit symbol", "ym"),
                        i18nc("unit description in lists", "yoctometers"),
                        i18nc("unit synonyms for matching user input", "yoctometer;yoctometers;ym"),
@@ -241,7 +219,6 @@ UnitCategory Length::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(LengthCategory,
                              Inch,
-                             0.0254,
                              i18nc("length unit symbol", "in"),
                              i18nc("unit description in lists", "inches"),
                              i18nc("unit synonyms for matching user input", "inch;inches;in;\""),
@@ -251,7 +228,6 @@ UnitCategory Length::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(LengthCategory,
                        Thou,
-                       0.0000254,
                        i18nc("length unit symbol", "thou"),
                        i18nc("unit description in lists", "thousandths of an inch"),
                        i18nc("unit synonyms for matching user input", "thou;mil;point;thousandth of an inch;thousandths of an inch"),
@@ -261,7 +237,6 @@ UnitCategory Length::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(LengthCategory,
                              Foot,
-                             0.3048,
                              i18nc("length unit symbol", "ft"),
                              i18nc("unit description in lists", "feet"),
                              i18nc("unit synonyms for matching user input", "foot;feet;ft"),
@@ -271,7 +246,6 @@ UnitCategory Length::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(LengthCategory,
                              Yard,
-                             0.9144,
                              i18nc("length unit symbol", "yd"),
                              i18nc("unit description in lists", "yards"),
                              i18nc("unit synonyms for matching user input", "yard;yards;yd"),
@@ -281,7 +255,6 @@ UnitCategory Length::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(LengthCategory,
                              Mile,
-                             1609.34,
                              i18nc("length unit symbol", "mi"),
                              i18nc("unit description in lists", "miles"),
                              i18nc("unit synonyms for matching user input", "mile;miles;mi"),
@@ -291,7 +264,6 @@ UnitCategory Length::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(LengthCategory,
                        NauticalMile,
-                       1852,
                        i18nc("length unit symbol", "nmi"),
                        i18nc("unit description in lists", "nautical miles"),
                        i18nc("unit synonyms for matching user input", "nautical mile;nautical miles;nmi"),
@@ -301,7 +273,6 @@ UnitCategory Length::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(LengthCategory,
                        LightYear,
-                       9.46073e+15,
                        i18nc("length unit symbol", "ly"),
                        i18nc("unit description in lists", "light-years"),
                        i18nc("unit synonyms for matching user input", "light-year;light-years;ly;lightyear;lightyears"),
@@ -311,7 +282,6 @@ UnitCategory Length::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(LengthCategory,
                        Parsec,
-                       3.08568e+16,
                        i18nc("length unit symbol", "pc"),
                        i18nc("unit description in lists", "parsecs"),
                        i18nc("unit synonyms for matching user input", "parsec;parsecs;pc"),
@@ -321,7 +291,6 @@ UnitCategory Length::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(LengthCategory,
                        AstronomicalUnit,
-                       1.49598e+11,
                        i18nc("length unit symbol", "au"),
                        i18nc("unit description in lists", "astronomical units"),
                        i18nc("unit synonyms for matching user input", "astronomical unit;astronomical units;au"),
@@ -331,7 +300,6 @@ UnitCategory Length::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(LengthCategory,
                        RackUnit,
-                       0.04445,
                        i18nc("length unit symbol", "ru"),
                        i18nc("unit description in lists", "rack units"),
                        i18nc("unit synonyms for matching user input", "rack unit;rack units;U;RU"),
@@ -341,7 +309,6 @@ UnitCategory Length::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(LengthCategory,
                         Link,
-                        0.201168,
                         i18nc("length unit symbol", "li"),
                         i18nc("unit description in lists", "links"),
                         i18nc("unit synonyms for matching user input", "link;links"),
@@ -351,7 +318,6 @@ UnitCategory Length::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(LengthCategory,
                         Chain,
-                        20.1168,
                         i18nc("length unit symbol", "ch"),
                         i18nc("unit description in lists", "chains"),
                         i18nc("unit synonyms for matching user input", "chain;chains"),
@@ -360,7 +326,6 @@ UnitCategory Length::makeCategory()
                         ki18ncp("amount in units (integer)", "%1 chain", "%1 chains")));
     d->addUnit(UnitPrivate::makeUnit(LengthCategory,
                         Furlong,
-                        201.168,
                         i18nc("length unit symbol", "fu"),
                         i18nc("unit description in lists", "furlongs"),
                         i18nc("unit synonyms for matching user input", "furlong;furlongs"),
@@ -370,7 +335,6 @@ UnitCategory Length::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(LengthCategory,
                         Fathom,
-                        1.8288,
                         i18nc("length unit symbol", "fa"),
                         i18nc("unit description in lists", "fathom"),
                         i18nc("unit synonyms for matching user input", "fathom;fathoms"),
@@ -380,7 +344,6 @@ UnitCategory Length::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(LengthCategory,
                         RodPerchPole,
-                        5.0292,
                         i18nc("length unit symbol", "r/p/p"),
                         i18nc("unit description in lists", "rods/perches/poles"),
                         i18nc("unit synonyms for matching user input", "rod;rods;perch;perches;pole;poles"),
@@ -388,6 +351,25 @@ UnitCategory Length::makeCategory()
                         ki18nc("amount in units (real)", "%1 rods/perches/poles"),
                         ki18ncp("amount in units (integer)", "%1 rod/perch/pole", "%1 rods/perches/poles")));
 
+    d->addUnitLadder({Yoctometer,
+                      Zeptometer,
+                      Attometer,
+                      Femtometer,
+                      Picometer,
+                      Nanometer,
+                      Micrometer,
+                      Millimeter,
+                      Meter,
+                      Kilometer,
+                      Megameter,
+                      Gigameter,
+                      Terameter,
+                      Petameter,
+                      Exameter,
+                      Zettameter,
+                      Yottameter},
+                     {Centimeter, Decimeter, Decameter, Hectometer});
+
     return c;
 }
 
@@ -21,7 +21,6 @@ UnitCategory Mass::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(MassCategory,
                        Yottagram,
-                       1e+24,
                        i18nc("mass unit symbol", "Yg"),
                        i18nc("unit description in lists", "yottagrams"),
                        i18nc("unit synonyms for matching user input", "yottagram;yottagrams;Yg"),
@@ -31,7 +30,6 @@ UnitCategory Mass::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(MassCategory,
                        Zettagram,
-                       1e+21,
                        i18nc("mass unit symbol", "Zg"),
                        i18nc("unit description in lists", "zettagrams"),
                        i18nc("unit synonyms for matching user input", "zettagram;zettagrams;Zg"),
@@ -41,7 +39,6 @@ UnitCategory Mass::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(MassCategory,
                        Exagram,
-                       1e+18,
                        i18nc("mass unit symbol", "Eg"),
                        i18nc("unit description in lists", "exagrams"),
                        i18nc("unit synonyms for matching user input", "exagram;exagrams;Eg"),
@@ -51,7 +48,6 @@ UnitCategory Mass::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(MassCategory,
                        Petagram,
-                       1e+15,
                        i18nc("mass unit symbol", "Pg"),
                        i18nc("unit description in lists", "petagrams"),
                        i18nc("unit synonyms for matching user input", "petagram;petagrams;Pg"),
@@ -61,7 +57,6 @@ UnitCategory Mass::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(MassCategory,
                        Teragram,
-                       1e+12,
                        i18nc("mass unit symbol", "Tg"),
                        i18nc("unit description in lists", "teragrams"),
                        i18nc("unit synonyms for matching user input", "teragram;teragrams;Tg"),
@@ -71,7 +66,6 @@ UnitCategory Mass::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(MassCategory,
                        Gigagram,
-                       1e+09,
                        i18nc("mass unit symbol", "Gg"),
                        i18nc("unit description in lists", "gigagrams"),
                        i18nc("unit synonyms for matching user input", "gigagram;gigagrams;Gg"),
@@ -81,7 +75,6 @@ UnitCategory Mass::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(MassCategory,
                        Megagram,
-                       1e+06,
                        i18nc("mass unit symbol", "Mg"),
                        i18nc("unit description in lists", "megagrams"),
                        i18nc("unit synonyms for matching user input", "megagram;megagrams;Mg"),
@@ -91,7 +84,6 @@ UnitCategory Mass::makeCategory()
 
     d->addDefaultUnit(UnitPrivate::makeUnit(MassCategory,
                               Kilogram,
-                              1000,
                               i18nc("mass unit symbol", "kg"),
                               i18nc("unit description in lists", "kilograms"),
                               i18nc("unit synonyms for matching user input", "kilogram;kilograms;kg"),
@@ -101,7 +93,6 @@ UnitCategory Mass::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(MassCategory,
                        Hectogram,
-                       100,
                        i18nc("mass unit symbol", "hg"),
                        i18nc("unit description in lists", "hectograms"),
                        i18nc("unit synonyms for matching user input", "hectogram;hectograms;hg"),
@@ -111,7 +102,6 @@ UnitCategory Mass::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(MassCategory,
                        Decagram,
-                       10,
                        i18nc("mass unit symbol", "dag"),
                        i18nc("unit description in lists", "decagrams"),
                        i18nc("unit synonyms for matching user input", "decagram;decagrams;dag"),
@@ -121,7 +111,6 @@ UnitCategory Mass::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(MassCategory,
                              Gram,
-                             1,
                              i18nc("mass unit symbol", "g"),
                              i18nc("unit description in lists", "grams"),
                              i18nc("unit synonyms for matching user input", "gram;grams;g"),
@@ -131,7 +120,6 @@ UnitCategory Mass::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(MassCategory,
                        Decigram,
-                       0.1,
                        i18nc("mass unit symbol", "dg"),
                        i18nc("unit description in lists", "decigrams"),
                        i18nc("unit synonyms for matching user input", "decigram;decigrams;dg"),
@@ -141,7 +129,6 @@ UnitCategory Mass::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(MassCategory,
                        Centigram,
-                       0.01,
                        i18nc("mass unit symbol", "cg"),
                        i18nc("unit description in lists", "centigrams"),
                        i18nc("unit synonyms for matching user input", "centigram;centigrams;cg"),
@@ -151,7 +138,6 @@ UnitCategory Mass::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(MassCategory,
                              Milligram,
-                             0.001,
                              i18nc("mass unit symbol", "mg"),
                              i18nc("unit description in lists", "milligrams"),
                              i18nc("unit synonyms for matching user input", "milligram;milligrams;mg"),
@@ -161,7 +147,6 @@ UnitCategory Mass::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(MassCategory,
                        Microgram,
-                       1e-06,
                        i18nc("mass unit symbol", "µg"),
                        i18nc("unit description in lists", "micrograms"),
                        i18nc("unit synonyms for matching user input", "microgram;micrograms;µg;ug"),
@@ -171,7 +156,6 @@ UnitCategory Mass::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(MassCategory,
                        Nanogram,
-                       1e-09,
                        i18nc("mass unit symbol", "ng"),
                        i18nc("unit description in lists", "nanograms"),
                        i18nc("unit synonyms for matching user input", "nanogram;nanograms;ng"),
@@ -181,7 +165,6 @@ UnitCategory Mass::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(MassCategory,
                        Picogram,
-                       1e-12,
                        i18nc("mass unit symbol", "pg"),
                        i18nc("unit description in lists", "picograms"),
                        i18nc("unit synonyms for matching user input", "picogram;picograms;pg"),
@@ -191,7 +174,6 @@ UnitCategory Mass::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(MassCategory,
                        Femtogram,
-                       1e-15,
                        i18nc("mass unit symbol", "fg"),
                        i18nc("unit description in lists", "femtograms"),
                        i18nc("unit synonyms for matching user input", "femtogram;femtograms;fg"),
@@ -201,7 +183,6 @@ UnitCategory Mass::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(MassCategory,
                        Attogram,
-                       1e-18,
                        i18nc("mass unit symbol", "ag"),
                        i18nc("unit description in lists", "attograms"),
                        i18nc("unit synonyms for matching user input", "attogram;attograms;ag"),
@@ -211,7 +192,6 @@ UnitCategory Mass::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(MassCategory,
                        Zeptogram,
-                       1e-21,
                        i18nc("mass unit symbol", "zg"),
                        i18nc("unit description in lists", "zeptograms"),
                        i18nc("unit synonyms for matching user input", "zeptogram;zeptograms;zg"),
@@ -221,7 +201,6 @@ UnitCategory Mass::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(MassCategory,
                        Yoctogram,
-                       1e-24,
                        i18nc("mass unit symbol", "yg"),
                        i18nc("unit description in lists", "yoctograms"),
                        i18nc("unit synonyms for matching user input", "yoctogram;yoctograms;yg"),
@@ -231,7 +210,6 @@ UnitCategory Mass::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(MassCategory,
                              Ton,
-                             1e+06,
                              i18nc("mass unit symbol", "t"),
                              i18nc("unit description in lists", "tons"),
                              i18nc("unit synonyms for matching user input", "ton;tons;t;tonne;tonnes"), // TODO Fix! Tonne == Metric Ton == Mg
@@ -242,7 +220,6 @@ UnitCategory Mass::makeCategory()
     // I guess it's useful...
     d->addUnit(UnitPrivate::makeUnit(MassCategory,
                        Carat,
-                       0.2,
                        i18nc("mass unit symbol", "CD"),
                        i18nc("unit description in lists", "carats"),
                        i18nc("unit synonyms for matching user input", "carat;carats;CD;ct"),
@@ -253,7 +230,6 @@ UnitCategory Mass::makeCategory()
     // http://en.wikipedia.org/wiki/Pound_(mass)#International_pound
     d->addCommonUnit(UnitPrivate::makeUnit(MassCategory,
                              Pound,
-                             453.592,
                              i18nc("mass unit symbol", "lb"),
                              i18nc("unit description in lists", "pounds"),
                              i18nc("unit synonyms for matching user input", "pound;pounds;lb;lbs"),
@@ -264,7 +240,6 @@ UnitCategory Mass::makeCategory()
     // International avoirdupois ounce
     d->addCommonUnit(UnitPrivate::makeUnit(MassCategory,
                              Ounce,
-                             28.3495,
                              i18nc("mass unit symbol", "oz"),
                              i18nc("unit description in lists", "ounces"),
                              i18nc("unit synonyms for matching user input", "ounce;ounces;oz"),
@@ -274,7 +249,6 @@ UnitCategory Mass::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(MassCategory,
                        TroyOunce,
-                       31.1035,
                        i18nc("mass unit symbol", "t oz"),
                        i18nc("unit description in lists", "troy ounces"),
                        i18nc("unit synonyms for matching user input", "troy ounce;troy ounces;t oz"),
@@ -284,7 +258,6 @@ UnitCategory Mass::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(MassCategory,
                        MassNewton,
-                       101.937,
                        i18nc("mass unit symbol", "N"),
                        i18nc("unit description in lists", "newtons"),
                        i18nc("unit synonyms for matching user input", "newton;newtons;N"),
@@ -295,7 +268,6 @@ UnitCategory Mass::makeCategory()
     // used a lot in industry (aircraft engines for example)
     d->addUnit(UnitPrivate::makeUnit(MassCategory,
                        Kilonewton,
-                       101937,
                        i18nc("mass unit symbol", "kN"),
                        i18nc("unit description in lists", "kilonewton"),
                        i18nc("unit synonyms for matching user input", "kilonewton;kilonewton;kN"),
@@ -305,7 +277,6 @@ UnitCategory Mass::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(MassCategory,
                        Stone,
-                       6350.29318,
                        i18nc("mass unit symbol", "st"),
                        i18nc("unit description in lists", "stone"),
                        i18nc("unit synonyms for matching user input", "stone;st"),
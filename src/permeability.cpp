@@ -19,7 +19,6 @@ UnitCategory Permeability::makeCategory()
 
     d->addDefaultUnit(UnitPrivate::makeUnit(PermeabilityCategory,
                               Darcy,
-                              1,
                               i18nc("volume unit symbol", "Darcy"),
                               i18nc("unit description in lists", "Darcy"),
                               i18nc("unit synonyms for matching user input", "Darcy;Darcys;Dar;Darc"),
@@ -29,7 +28,6 @@ UnitCategory Permeability::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(PermeabilityCategory,
                              MiliDarcy,
-                             0.001,
                              i18nc("volume unit symbol", "mDarcy"),
                              i18nc("unit description in lists", "Milli-Darcy"),
                              i18nc("unit synonyms for matching user input", "Milli-Darcy;MilliDarcy;MilliDar;mDarcy;mDar;mDarc"),
@@ -39,7 +37,6 @@ UnitCategory Permeability::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(PermeabilityCategory,
                              PermeabilitySquareMicrometer,
-                             0.9869233,
                              i18nc("volume unit symbol", "µm²"),
                              i18nc("unit description in lists", "squaremicrometers"),
                              i18nc("unit synonyms for matching user input", "Permeability;Pµm²;PSquare µm;squaremicrometers;Pµm^2"),
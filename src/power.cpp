@@ -18,14 +18,13 @@ class DecibelUnitPrivate : public UnitPrivate
 public:
     DecibelUnitPrivate(CategoryId categoryId,
                        UnitId id,
-                       qreal multiplier,
                        const QString &symbol,
                        const QString &description,
                        const QString &matchString,
                        const KLocalizedString &symbolString,
                        const KLocalizedString &realString,
                        const KLocalizedString &integerString)
-        : UnitPrivate(categoryId, id, multiplier, symbol, description, matchString, symbolString, realString, integerString)
+        : UnitPrivate(categoryId, id, symbol, description, matchString, symbolString, realString, integerString)
     {
     }
 
@@ -52,7 +51,6 @@ UnitCategory Power::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(PowerCategory,
                        Yottawatt,
-                       1e+24,
                        i18nc("power unit symbol", "YW"),
                        i18nc("unit description in lists", "yottawatts"),
                        i18nc("unit synonyms for matching user input", "yottawatt;yottawatts;YW"),
@@ -62,7 +60,6 @@ UnitCategory Power::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(PowerCategory,
                        Zettawatt,
-                       1e+21,
                        i18nc("power unit symbol", "ZW"),
                        i18nc("unit description in lists", "zettawatts"),
                        i18nc("unit synonyms for matching user input", "zettawatt;zettawatts;ZW"),
@@ -72,7 +69,6 @@ UnitCategory Power::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(PowerCategory,
                        Exawatt,
-                       1e+18,
                        i18nc("power unit symbol", "EW"),
                        i18nc("unit description in lists", "exawatts"),
                        i18nc("unit synonyms for matching user input", "exawatt;exawatts;EW"),
@@ -82,7 +78,6 @@ UnitCategory Power::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(PowerCategory,
                        Petawatt,
-                       1e+15,
                        i18nc("power unit symbol", "PW"),
                        i18nc("unit description in lists", "petawatts"),
                        i18nc("unit synonyms for matching user input", "petawatt;petawatts;PW"),
@@ -92,7 +87,6 @@ UnitCategory Power::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(PowerCategory,
                        Terawatt,
-                       1e+12,
                        i18nc("power unit symbol", "TW"),
                        i18nc("unit description in lists", "terawatts"),
                        i18nc("unit synonyms for matching user input", "terawatt;terawatts;TW"),
@@ -102,7 +96,6 @@ UnitCategory Power::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(PowerCategory,
                        Gigawatt,
-                       1e+09,
                        i18nc("power unit symbol", "GW"),
                        i18nc("unit description in lists", "gigawatts"),
                        i18nc("unit synonyms for matching user input", "gigawatt;gigawatts;GW"),
@@ -112,7 +105,6 @@ UnitCategory Power::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(PowerCategory,
                        Megawatt,
-                       1e+06,
                        i18nc("power unit symbol", "MW"),
                        i18nc("unit description in lists", "megawatts"),
                        i18nc("unit synonyms for matching user input", "megawatt;megawatts;MW"),
@@ -122,7 +114,6 @@ UnitCategory Power::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(PowerCategory,
                              Kilowatt,
-                             1000,
                              i18nc("power unit symbol", "kW"),
                              i18nc("unit description in lists", "kilowatts"),
                              i18nc("unit synonyms for matching user input", "kilowatt;kilowatts;kW"),
@@ -132,7 +123,6 @@ UnitCategory Power::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(PowerCategory,
                        Hectowatt,
-                       100,
                        i18nc("power unit symbol", "hW"),
                        i18nc("unit description in lists", "hectowatts"),
                        i18nc("unit synonyms for matching user input", "hectowatt;hectowatts;hW"),
@@ -142,7 +132,6 @@ UnitCategory Power::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(PowerCategory,
                        Decawatt,
-                       10,
                        i18nc("power unit symbol", "daW"),
                        i18nc("unit description in lists", "decawatts"),
                        i18nc("unit synonyms for matching user input", "decawatt;decawatts;daW"),
@@ -152,7 +141,6 @@ UnitCategory Power::makeCategory()
 
     d->addDefaultUnit(UnitPrivate::makeUnit(PowerCategory,
                               Watt,
-                              1,
                               i18nc("power unit symbol", "W"),
                               i18nc("unit description in lists", "watts"),
                               i18nc("unit synonyms for matching user input", "watt;watts;W"),
@@ -162,7 +150,6 @@ UnitCategory Power::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(PowerCategory,
                        Deciwatt,
-                       0.1,
                        i18nc("power unit symbol", "dW"),
                        i18nc("unit description in lists", "deciwatts"),
                        i18nc("unit synonyms for matching user input", "deciwatt;deciwatts;dW"),
@@ -172,7 +159,6 @@ UnitCategory Power::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(PowerCategory,
                        Centiwatt,
-                       0.01,
                        i18nc("power unit symbol", "cW"),
                        i18nc("unit description in lists", "centiwatts"),
                        i18nc("unit synonyms for matching user input", "centiwatt;centiwatts;cW"),
@@ -182,7 +168,6 @@ UnitCategory Power::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(PowerCategory,
                        Milliwatt,
-                       0.001,
                        i18nc("power unit symbol", "mW"),
                        i18nc("unit description in lists", "milliwatts"),
                        i18nc("unit synonyms for matching user input", "milliwatt;milliwatts;mW"),
@@ -192,7 +177,6 @@ UnitCategory Power::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(PowerCategory,
                        Microwatt,
-                       1e-06,
                        i18nc("power unit symbol", "µW"),
                        i18nc("unit description in lists", "microwatts"),
                        i18nc("unit synonyms for matching user input", "microwatt;microwatts;µW;uW"),
@@ -202,7 +186,6 @@ UnitCategory Power::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(PowerCategory,
                        Nanowatt,
-                       1e-09,
                        i18nc("power unit symbol", "nW"),
                        i18nc("unit description in lists", "nanowatts"),
                        i18nc("unit synonyms for matching user input", "nanowatt;nanowatts;nW"),
@@ -212,7 +195,6 @@ UnitCategory Power::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(PowerCategory,
                        Picowatt,
-                       1e-12,
                        i18nc("power unit symbol", "pW"),
                        i18nc("unit description in lists", "picowatts"),
                        i18nc("unit synonyms for matching user input", "picowatt;picowatts;pW"),
@@ -222,7 +204,6 @@ UnitCategory Power::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(PowerCategory,
                        Femtowatt,
-                       1e-15,
                        i18nc("power unit symbol", "fW"),
                        i18nc("unit description in lists", "femtowatts"),
                        i18nc("unit synonyms for matching user input", "femtowatt;femtowatts;fW"),
@@ -232,7 +213,6 @@ UnitCategory Power::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(PowerCategory,
                        Attowatt,
-                       1e-18,
                        i18nc("power unit symbol", "aW"),
                        i18nc("unit description in lists", "attowatts"),
                        i18nc("unit synonyms for matching user input", "attowatt;attowatts;aW"),
@@ -242,7 +222,6 @@ UnitCategory Power::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(PowerCategory,
                        Zeptowatt,
-                       1e-21,
                        i18nc("power unit symbol", "zW"),
                        i18nc("unit description in lists", "zeptowatts"),
                        i18nc("unit synonyms for matching user input", "zeptowatt;zeptowatts;zW"),
@@ -252,7 +231,6 @@ UnitCategory Power::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(PowerCategory,
                        Yoctowatt,
-                       1e-24,
                        i18nc("power unit symbol", "yW"),
                        i18nc("unit description in lists", "yoctowatts"),
                        i18nc("unit synonyms for matching user input", "yoctowatt;yoctowatts;yW"),
@@ -262,7 +240,6 @@ UnitCategory Power::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(PowerCategory,
                              Horsepower,
-                             735.499,
                              i18nc("power unit symbol", "hp"),
                              i18nc("unit description in lists", "horsepowers"),
                              i18nc("unit synonyms for matching user input", "horsepower;horsepowers;hp"),
@@ -274,7 +251,6 @@ UnitCategory Power::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(new DecibelUnitPrivate(PowerCategory,
                                               DecibelKilowatt,
-                                              1000,
                                               i18nc("power unit symbol", "dBk"),
                                               i18nc("unit description in lists", "decibel kilowatts"),
                                               i18nc("unit synonyms for matching user input", "dBk;dBkW;dB(kW)"),
@@ -284,7 +260,6 @@ UnitCategory Power::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(new DecibelUnitPrivate(PowerCategory,
                                               DecibelWatt,
-                                              1,
                                               i18nc("power unit symbol", "dBW"),
                                               i18nc("unit description in lists", "decibel watts"),
                                               i18nc("unit synonyms for matching user input", "dBW;dB(W)"),
@@ -294,7 +269,6 @@ UnitCategory Power::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(new DecibelUnitPrivate(PowerCategory,
                                                     DecibelMilliwatt,
-                                                    0.001,
                                                     i18nc("power unit symbol", "dBm"),
                                                     i18nc("unit description in lists", "decibel milliwatts"),
                                                     i18nc("unit synonyms for matching user input", "dBm;dBmW;dB(mW)"),
@@ -304,7 +278,6 @@ UnitCategory Power::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(new DecibelUnitPrivate(PowerCategory,
                                               DecibelMicrowatt,
-                                              1e-6,
                                               i18nc("power unit symbol", "dBµW"),
                                               i18nc("unit description in lists", "decibel microwatts"),
                                               i18nc("unit synonyms for matching user input", "dBuW;dBµW;dB(uW);dB(µW)"),
@@ -312,6 +285,25 @@ UnitCategory Power::makeCategory()
                                               ki18nc("amount in units (real)", "%1 decibel microwatts"),
                                               ki18ncp("amount in units (integer)", "%1 decibel microwatt", "%1 decibel microwatts"))));
 
+    d->addUnitLadder({Yoctowatt,
+                      Zeptowatt,
+                      Attowatt,
+                      Femtowatt,
+                      Picowatt,
+                      Nanowatt,
+                      Microwatt,
+                      Milliwatt,
+                      Watt,
+                      Kilowatt,
+                      Megawatt,
+                      Gigawatt,
+                      Terawatt,
+                      Petawatt,
+                      Exawatt,
+                      Zettawatt,
+                      Yottawatt},
+                     {Centiwatt, Deciwatt, Decawatt, Hectowatt});
+
     return c;
 }
 
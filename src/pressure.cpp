@@ -20,7 +20,6 @@ UnitCategory Pressure::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(PressureCategory,
                        Yottapascal,
-                       1e+24,
                        i18nc("pressure unit symbol", "YPa"),
                        i18nc("unit description in lists", "yottapascals"),
                        i18nc("unit synonyms for matching user input", "yottapascal;yottapascals;YPa"),
@@ -30,7 +29,6 @@ UnitCategory Pressure::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(PressureCategory,
                        Zettapascal,
-                       1e+21,
                        i18nc("pressure unit symbol", "ZPa"),
                        i18nc("unit description in lists", "zettapascals"),
                        i18nc("unit synonyms for matching user input", "zettapascal;zettapascals;ZPa"),
@@ -40,7 +38,6 @@ UnitCategory Pressure::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(PressureCategory,
                        Exapascal,
-                       1e+18,
                        i18nc("pressure unit symbol", "EPa"),
                        i18nc("unit description in lists", "exapascals"),
                        i18nc("unit synonyms for matching user input", "exapascal;exapascals;EPa"),
@@ -50,7 +47,6 @@ UnitCategory Pressure::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(PressureCategory,
                        Petapascal,
-                       1e+15,
                        i18nc("pressure unit symbol", "PPa"),
                        i18nc("unit description in lists", "petapascals"),
                        i18nc("unit synonyms for matching user input", "petapascal;petapascals;PPa"),
@@ -60,7 +56,6 @@ UnitCategory Pressure::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(PressureCategory,
                        Terapascal,
-                       1e+12,
                        i18nc("pressure unit symbol", "TPa"),
                        i18nc("unit description in lists", "terapascals"),
                        i18nc("unit synonyms for matching user input", "terapascal;terapascals;TPa"),
@@ -70,7 +65,6 @@ UnitCategory Pressure::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(PressureCategory,
                        Gigapascal,
-                       1e+09,
                        i18nc("pressure unit symbol", "GPa"),
                        i18nc("unit description in lists", "gigapascals"),
                        i18nc("unit synonyms for matching user input", "gigapascal;gigapascals;GPa"),
@@ -80,7 +74,6 @@ UnitCategory Pressure::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(PressureCategory,
                              Megapascal,
-                             1e+06,
                              i18nc("pressure unit symbol", "MPa"),
                              i18nc("unit description in lists", "megapascals"),
                              i18nc("unit synonyms for matching user input", "megapascal;megapascals;MPa"),
@@ -90,7 +83,6 @@ UnitCategory Pressure::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(PressureCategory,
                        Kilopascal,
-                       1000,
                        i18nc("pressure unit symbol", "kPa"),
                        i18nc("unit description in lists", "kilopascals"),
                        i18nc("unit synonyms for matching user input", "kilopascal;kilopascals;kPa"),
@@ -100,7 +92,6 @@ UnitCategory Pressure::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(PressureCategory,
                              Hectopascal,
-                             100,
                              i18nc("pressure unit symbol", "hPa"),
                              i18nc("unit description in lists", "hectopascals"),
                              i18nc("unit synonyms for matching user input", "hectopascal;hectopascals;hPa"),
@@ -110,7 +101,6 @@ UnitCategory Pressure::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(PressureCategory,
                        Decapascal,
-                       10,
                        i18nc("pressure unit symbol", "daPa"),
                        i18nc("unit description in lists", "decapascals"),
                        i18nc("unit synonyms for matching user input", "decapascal;decapascals;daPa"),
@@ -120,7 +110,6 @@ UnitCategory Pressure::makeCategory()
 
     d->addDefaultUnit(UnitPrivate::makeUnit(PressureCategory,
                               Pascal,
-                              1,
                               i18nc("pressure unit symbol", "Pa"),
                               i18nc("unit description in lists", "pascals"),
                               i18nc("unit synonyms for matching user input", "pascal;pascals;Pa"),
@@ -130,7 +119,6 @@ UnitCategory Pressure::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(PressureCategory,
                        Decipascal,
-                       0.1,
                        i18nc("pressure unit symbol", "dPa"),
                        i18nc("unit description in lists", "decipascals"),
                        i18nc("unit synonyms for matching user input", "decipascal;decipascals;dPa"),
@@ -140,7 +128,6 @@ UnitCategory Pressure::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(PressureCategory,
                        Centipascal,
-                       0.01,
                        i18nc("pressure unit symbol", "cPa"),
                        i18nc("unit description in lists", "centipascals"),
                        i18nc("unit synonyms for matching user input", "centipascal;centipascals;cPa"),
@@ -150,7 +137,6 @@ UnitCategory Pressure::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(PressureCategory,
                        Millipascal,
-                       0.001,
                        i18nc("pressure unit symbol", "mPa"),
                        i18nc("unit description in lists", "millipascals"),
                        i18nc("unit synonyms for matching user input", "millipascal;millipascals;mPa"),
@@ -160,7 +146,6 @@ UnitCategory Pressure::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(PressureCategory,
                        Micropascal,
-                       1e-06,
                        i18nc("pressure unit symbol", "µPa"),
                        i18nc("unit description in lists", "micropascals"),
                        i18nc("unit synonyms for matching user input", "micropascal;micropascals;µPa;uPa"),
@@ -170,7 +155,6 @@ UnitCategory Pressure::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(PressureCategory,
                        Nanopascal,
-                       1e-09,
                        i18nc("pressure unit symbol", "nPa"),
                        i18nc("unit description in lists", "nanopascals"),
                        i18nc("unit synonyms for matching user input", "nanopascal;nanopascals;nPa"),
@@ -180,7 +164,6 @@ UnitCategory Pressure::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(PressureCategory,
                        Picopascal,
-                       1e-12,
                        i18nc("pressure unit symbol", "pPa"),
                        i18nc("unit description in lists", "picopascals"),
                        i18nc("unit synonyms for matching user input", "picopascal;picopascals;pPa"),
@@ -190,7 +173,6 @@ UnitCategory Pressure::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(PressureCategory,
                        Femtopascal,
-                       1e-15,
                        i18nc("pressure unit symbol", "fPa"),
                        i18nc("unit description in lists", "femtopascals"),
                        i18nc("unit synonyms for matching user input", "femtopascal;femtopascals;fPa"),
@@ -200,7 +182,6 @@ UnitCategory Pressure::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(PressureCategory,
                        Attopascal,
-                       1e-18,
                        i18nc("pressure unit symbol", "aPa"),
                        i18nc("unit description in lists", "attopascals"),
                        i18nc("unit synonyms for matching user input", "attopascal;attopascals;aPa"),
@@ -210,7 +191,6 @@ UnitCategory Pressure::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(PressureCategory,
                        Zeptopascal,
-                       1e-21,
                        i18nc("pressure unit symbol", "zPa"),
                        i18nc("unit description in lists", "zeptopascals"),
                        i18nc("unit synonyms for matching user input", "zeptopascal;zeptopascals;zPa"),
@@ -220,7 +200,6 @@ UnitCategory Pressure::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(PressureCategory,
                        Yoctopascal,
-                       1e-24,
                        i18nc("pressure unit symbol", "yPa"),
                        i18nc("unit description in lists", "yoctopascals"),
                        i18nc("unit synonyms for matching user input", "yoctopascal;yoctopascals;yPa"),
@@ -230,7 +209,6 @@ UnitCategory Pressure::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(PressureCategory,
                              Bar,
-                             100000,
                              i18nc("pressure unit symbol", "bar"),
                              i18nc("unit description in lists", "bars"),
                              i18nc("unit synonyms for matching user input", "bar;bars;bar"),
@@ -240,7 +218,6 @@ UnitCategory Pressure::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(PressureCategory,
                        Millibar,
-                       100,
                        i18nc("pressure unit symbol", "mbar"),
                        i18nc("unit description in lists", "millibars"),
                        i18nc("unit synonyms for matching user input", "millibar;millibars;mbar;mb"),
@@ -250,7 +227,6 @@ UnitCategory Pressure::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(PressureCategory,
                        Decibar,
-                       10000,
                        i18nc("pressure unit symbol", "dbar"),
                        i18nc("unit description in lists", "decibars"),
                        i18nc("unit synonyms for matching user input", "decibar;decibars;dbar"),
@@ -260,7 +236,6 @@ UnitCategory Pressure::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(PressureCategory,
                        Torr,
-                       133.322,
                        i18nc("pressure unit symbol", "Torr"),
                        i18nc("unit description in lists", "Torr"),
                        i18nc("unit synonyms for matching user input", "Torr"),
@@ -270,7 +245,6 @@ UnitCategory Pressure::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(PressureCategory,
                        TechnicalAtmosphere,
-                       98066.5,
                        i18nc("pressure unit symbol", "at"),
                        i18nc("unit description in lists", "technical atmospheres"),
                        i18nc("unit synonyms for matching user input", "technical atmosphere;technical atmospheres;at"),
@@ -280,7 +254,6 @@ UnitCategory Pressure::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(PressureCategory,
                              Atmosphere,
-                             101325,
                              i18nc("pressure unit symbol", "atm"),
                              i18nc("unit description in lists", "atmospheres"),
                              i18nc("unit synonyms for matching user input", "atmosphere;atmospheres;atm"),
@@ -290,7 +263,6 @@ UnitCategory Pressure::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(PressureCategory,
                              PoundForcePerSquareInch,
-                             6894.76,
                              i18nc("pressure unit symbol", "psi"),
                              i18nc("unit description in lists", "pound-force per square inch"),
                              i18nc("unit synonyms for matching user input", "pound-force per square inch;pound-force per square inches;psi"),
@@ -301,7 +273,6 @@ UnitCategory Pressure::makeCategory()
     // http://en.wikipedia.org/wiki/InHg
     d->addCommonUnit(UnitPrivate::makeUnit(PressureCategory,
                              InchesOfMercury,
-                             3386.39,
                              i18nc("pressure unit symbol", "inHg"),
                              i18nc("unit description in lists", "inches of mercury"),
                              i18nc("unit synonyms for matching user input", "inch of mercury;inches of mercury;inHg;in\""),
@@ -312,7 +283,6 @@ UnitCategory Pressure::makeCategory()
     // http://en.wikipedia.org/wiki/MmHg#mmHg
     d->addUnit(UnitPrivate::makeUnit(PressureCategory,
                        MillimetersOfMercury,
-                       133.322,
                        i18nc("pressure unit symbol", "mmHg"),
                        i18nc("unit description in lists", "millimeters of mercury"),
                        i18nc("unit synonyms for matching user input", "millimeter of mercury;millimeters of mercury;mmHg"),
@@ -0,0 +1,218 @@
+/*
+ *   SPDX-FileCopyrightText: 2026 KUnitConversion Authors
+ *
+ *   SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#include "quantity.h"
+#include "converter_p.h"
+#include "unitcategory_p.h"
+#include "value.h"
+
+#include <cmath>
+#include <type_traits>
+
+namespace KUnitConversion
+{
+static_assert(std::is_trivially_copyable_v<Quantity>);
+
+namespace
+{
+struct NumberFormat {
+    const QLocale &locale;
+    QString decimalPoint;
+    QString groupSeparator;
+    QString negativeSign;
+    QString positiveSign;
+};
+}
+
+static qsizetype matchAny(QStringView text, std::initializer_list<QStringView> candidates)
+{
+    for (const QStringView candidate : candidates) {
+        if (!candidate.isEmpty() && text.startsWith(candidate)) {
+            return candidate.size();
+        }
+    }
+    return 0;
+}
+
+static bool isDigitAt(QStringView text, qsizetype pos)
+{
+    return pos < text.size() && text[pos].isDigit();
+}
+
+/**
+ * Length of the number at the start of @p text, 0 if there is none.
+ */
+static qsizetype numberLength(QStringView text, const NumberFormat &format, bool allowSign)
+{
+    qsizetype pos = allowSign ? matchAny(text, {u"-", u"+", format.negativeSign, format.positiveSign}) : 0;
+    bool hasDigits = false;
+    while (pos < text.size()) {
+        if (text[pos].isDigit()) {
+            hasDigits = true;
+            ++pos;
+            continue;
+        }
+        // separators only belong to the number if a digit follows
+        const qsizetype separator = matchAny(text.sliced(pos), {u".", u",", format.decimalPoint, format.groupSeparator});
+        if (separator == 0 || !isDigitAt(text, pos + separator)) {
+            break;
+        }
+        pos += separator;
+    }
+    if (!hasDigits) {
+        return 0;
+    }
+
+    // an exponent needs digits, so that units starting with e are not swallowed
+    if (pos < text.size() && (text[pos] == QLatin1Char('e') || text[pos] == QLatin1Char('E'))) {
+        qsizetype exponent = pos + 1;
+        exponent += matchAny(text.sliced(exponent), {u"-", u"+"});
+        if (isDigitAt(text, exponent)) {
+            pos = exponent;
+            while (isDigitAt(text, pos)) {
+                ++pos;
+            }
+        }
+    }
+    return pos;
+}
+
+static bool toNumber(QStringView text, const NumberFormat &format, qreal &number)
+{
+    bool ok = false;
+    number = format.locale.toDouble(text, &ok);
+    if (!ok && format.locale != QLocale::c()) {
+        number = QLocale::c().toDouble(text, &ok);
+    }
+    return ok;
+}
+
+/**
+ * Start of the last number following whitespace before @p end in @p text, 0 if there is none.
+ */
+static qsizetype previousTermStart(QStringView text, qsizetype end, const NumberFormat &format)
+{
+    for (qsizetype pos = end - 1; pos > 0; --pos) {
+        if (text[pos - 1].isSpace() && !text[pos].isSpace() && numberLength(text.sliced(pos), format, false) > 0) {
+            return pos;
+        }
+    }
+    return 0;
+}
+
+/**
+ * Parses "number unit [number unit ...]" from @p text and adds it to @p total,
+ * which is set to the first term if @p first is true.
+ */
+static bool parseTerms(QStringView text, const NumberFormat &format, ConverterPrivate *d, bool first, Quantity &total)
+{
+    const qsizetype length = numberLength(text, format, first);
+    qreal number;
+    if (length == 0 || !toNumber(text.first(length), format, number)) {
+        return false;
+    }
+
+    // try the longest unit name first, so that names containing numbers such as
+    // "l/100 km" win over splitting the text into several terms
+    const QStringView units = text.sliced(length).trimmed();
+    for (qsizetype end = units.size(); end > 0; end = previousTermStart(units, end, format)) {
+        const QStringView name = units.first(end).trimmed();
+        const Unit *unit = d->unit(QString::fromRawData(name.data(), name.size()));
+        if (!unit) {
+            continue;
+        }
+
+        Quantity sum(number, unit->id());
+        if (!first) {
+            // a leading sign applies to all terms
+            const qreal term = sum.convertTo(total.unitId()).number();
+            sum = Quantity(std::signbit(total.number()) ? total.number() - term : total.number() + term, total.unitId());
+            if (qIsNaN(sum.number())) {
+                continue;
+            }
+        }
+        if (end == units.size() || parseTerms(units.sliced(end), format, d, false, sum)) {
+            total = sum;
+            return true;
+        }
+    }
+    return false;
+}
+
+Quantity::Quantity(const Value &value)
+    : m_number(value.number())
+    , m_unitId(value.unit().id())
+{
+}
+
+Quantity Quantity::fromString(QStringView text, const QLocale &locale)
+{
+    const NumberFormat format{locale, locale.decimalPoint(), locale.groupSeparator(), locale.negativeSign(), locale.positiveSign()};
+    Quantity quantity;
+    if (parseTerms(text.trimmed(), format, ConverterPrivate::instance(), true, quantity)) {
+        return quantity;
+    }
+    return Quantity();
+}
+
+Value Quantity::toValue() const
+{
+    if (const Unit *unit = ConverterPrivate::instance()->unit(m_unitId)) {
+        return Value(m_number, *unit);
+    }
+    return Value();
+}
+
+bool Quantity::isValid() const
+{
+    return ConverterPrivate::instance()->unit(m_unitId) && !qIsNaN(m_number);
+}
+
+Unit Quantity::unit() const
+{
+    if (const Unit *unit = ConverterPrivate::instance()->unit(m_unitId)) {
+        return *unit;
+    }
+    return Unit();
+}
+
+Quantity Quantity::convertTo(UnitId unitId) const
+{
+    ConverterPrivate *d = ConverterPrivate::instance();
+    const Unit *from = d->unit(m_unitId);
+    const Unit *to = d->unit(unitId);
+    if (!from || !to) {
+        return Quantity(qQNaN(), unitId);
+    }
+    return Quantity(UnitCategoryPrivate::kernelFor(*from, *to).apply(m_number), unitId);
+}
+
+Qt::partial_ordering Quantity::compare(const Quantity &other) const
+{
+    const qreal otherNumber = other.m_unitId == m_unitId ? other.m_number : other.convertTo(m_unitId).m_number;
+    if (!isValid() || qIsNaN(otherNumber)) {
+        return Qt::partial_ordering::unordered;
+    }
+    return Qt::compareThreeWay(m_number, otherNumber);
+}
+
+QString Quantity::toString(int fieldWidth, char format, int precision, const QChar &fillChar) const
+{
+    if (const Unit *unit = ConverterPrivate::instance()->unit(m_unitId); unit && !qIsNaN(m_number)) {
+        return unit->toString(m_number, fieldWidth, format, precision, fillChar);
+    }
+    return QString();
+}
+
+QString Quantity::toSymbolString(int fieldWidth, char format, int precision, const QChar &fillChar) const
+{
+    if (const Unit *unit = ConverterPrivate::instance()->unit(m_unitId); unit && !qIsNaN(m_number)) {
+        return unit->toSymbolString(m_number, fieldWidth, format, precision, fillChar);
+    }
+    return QString();
+}
+
+}
@@ -0,0 +1,161 @@
+/*
+ *   SPDX-FileCopyrightText: 2026 KUnitConversion Authors
+ *
+ *   SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#ifndef KUNITCONVERSION_QUANTITY_H
+#define KUNITCONVERSION_QUANTITY_H
+
+#include "kunitconversion/kunitconversion_export.h"
+
+#include "unit.h"
+
+#include <QLocale>
+#include <QString>
+#include <QStringView>
+#include <QtCompare>
+
+namespace KUnitConversion
+{
+class Value;
+
+/*!
+ * \class KUnitConversion::Quantity
+ * \inmodule KUnitConversion
+ *
+ * \brief Lightweight value in a unit of measurement.
+ *
+ * A quantity holds a number and the id of its unit, and nothing else. Unlike
+ * Value it is trivially copyable and never allocates, which makes it suitable
+ * for storing and converting large numbers of values. Units are resolved by
+ * id when needed.
+ *
+ * \sa Value, Converter
+ * \since 6.28
+ */
+class KUNITCONVERSION_EXPORT Quantity
+{
+public:
+    /*!
+     * Creates an invalid quantity.
+     */
+    constexpr Quantity() noexcept = default;
+
+    /*!
+     * Creates a quantity of \a number in the unit \a unitId.
+     */
+    constexpr Quantity(qreal number, UnitId unitId) noexcept
+        : m_number(number)
+        , m_unitId(unitId)
+    {
+    }
+
+    /*!
+     * Creates a quantity with the number and unit of \a value.
+     */
+    explicit Quantity(const Value &value);
+
+    /*!
+     * Parses a quantity such as "12.5 km/h", "-3e2 m" or "3 ft 4 in" from \a text.
+     *
+     * The number may use the decimal and group separators of \a locale or
+     * of the C locale, and an exponent. The unit is matched against the unit
+     * symbols and synonyms of all categories, the space between number and
+     * unit is optional. Several number and unit pairs in units of the same
+     * category are added up and expressed in the first unit, a leading sign
+     * applies to the sum.
+     *
+     * The text is parsed in place, no part of it is copied to look up the
+     * unit. Use toValue() to get a Value.
+     *
+     * Returns an invalid quantity if \a text is not a quantity.
+     **/
+    static Quantity fromString(QStringView text, const QLocale &locale = QLocale());
+
+    /*!
+     * Returns the quantity as a Value.
+     */
+    Value toValue() const;
+
+    /*!
+     * Returns true if the unit is known and the number is not NaN.
+     **/
+    bool isValid() const;
+
+    /*!
+     * Number part of the quantity
+     **/
+    constexpr qreal number() const noexcept
+    {
+        return m_number;
+    }
+
+    /*!
+     * Id of the unit of the quantity
+     **/
+    constexpr UnitId unitId() const noexcept
+    {
+        return m_unitId;
+    }
+
+    /*!
+     * Unit part of the quantity, a null unit if the id is unknown
+     **/
+    Unit unit() const;
+
+    /*!
+     * Convert to the unit \a unitId.
+     *
+     * The number is converted like ConversionPlan does, so it may differ from
+     * Value::convertTo() in the last bits as documented there.
+     *
+     * Returns an invalid quantity with a NaN number if the units belong to
+     * different categories or are unknown.
+     **/
+    Quantity convertTo(UnitId unitId) const;
+
+    /*!
+     * Compare the amounts of this quantity and \a other, converting \a other
+     * to the unit of this quantity first.
+     *
+     * Returns \c Qt::partial_ordering::unordered if one of the quantities is
+     * invalid or if their units belong to different categories.
+     **/
+    Qt::partial_ordering compare(const Quantity &other) const;
+
+    /*!
+     * Convert quantity to a string, see Value::toString()
+     **/
+    QString toString(int fieldWidth = 0, char format = 'g', int precision = -1, const QChar &fillChar = QLatin1Char(' ')) const;
+
+    /*!
+     * Convert quantity to a string with symbol, see Value::toSymbolString()
+     **/
+    QString toSymbolString(int fieldWidth = 0, char format = 'g', int precision = -1, const QChar &fillChar = QLatin1Char(' ')) const;
+
+    /*!
+     * Returns true if \a lhs and \a rhs have the same number and unit.
+     *
+     * Use compare() to compare the amounts of quantities in different units.
+     **/
+    friend constexpr bool operator==(const Quantity &lhs, const Quantity &rhs) noexcept
+    {
+        return lhs.m_number == rhs.m_number && lhs.m_unitId == rhs.m_unitId;
+    }
+
+    friend constexpr bool operator!=(const Quantity &lhs, const Quantity &rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    qreal m_number = 0.0;
+    UnitId m_unitId = InvalidUnit;
+};
+
+} // KUnitConversion namespace
+
+Q_DECLARE_TYPEINFO(KUnitConversion::Quantity, Q_PRIMITIVE_TYPE);
+
+#endif
@@ -0,0 +1,214 @@
+/*
+ *   SPDX-FileCopyrightText: 2026 KUnitConversion Authors
+ *
+ *   SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#include "simdkernels_p.h"
+
+#include <algorithm>
+
+#if defined(Q_PROCESSOR_X86_64) && (defined(Q_CC_GNU) || defined(Q_CC_CLANG))
+#define KUNITCONVERSION_X86_SIMD 1
+#include <immintrin.h>
+#endif
+
+namespace KUnitConversion
+{
+namespace Simd
+{
+// This file is built without floating point contraction, a fused multiply-add
+// would round differently than the separate multiplication and addition done
+// by every level. Vectorized variants only process whole vectors and return how
+// many values they handled, the remainder is left to the scalar loop.
+
+template<bool Affine, typename T>
+static void convertScalar(const T *input, T *output, qsizetype size, double a, double b)
+{
+    for (qsizetype i = 0; i < size; ++i) {
+        if constexpr (Affine) {
+            output[i] = T(a * double(input[i]) + b);
+        } else {
+            output[i] = T(a * double(input[i]));
+        }
+    }
+}
+
+#ifdef KUNITCONVERSION_X86_SIMD
+// SSE2 is part of the x86-64 baseline
+template<bool Affine>
+static inline __m128d applySse2(__m128d value, __m128d a, __m128d b)
+{
+    value = _mm_mul_pd(a, value);
+    if constexpr (Affine) {
+        value = _mm_add_pd(value, b);
+    }
+    return value;
+}
+
+template<bool Affine>
+static qsizetype convertSse2(const double *input, double *output, qsizetype size, double a, double b)
+{
+    const __m128d va = _mm_set1_pd(a);
+    const __m128d vb = _mm_set1_pd(b);
+    qsizetype i = 0;
+    for (; i + 2 <= size; i += 2) {
+        _mm_storeu_pd(output + i, applySse2<Affine>(_mm_loadu_pd(input + i), va, vb));
+    }
+    return i;
+}
+
+template<bool Affine>
+static qsizetype convertSse2(const float *input, float *output, qsizetype size, double a, double b)
+{
+    const __m128d va = _mm_set1_pd(a);
+    const __m128d vb = _mm_set1_pd(b);
+    qsizetype i = 0;
+    for (; i + 4 <= size; i += 4) {
+        const __m128 value = _mm_loadu_ps(input + i);
+        const __m128d low = applySse2<Affine>(_mm_cvtps_pd(value), va, vb);
+        const __m128d high = applySse2<Affine>(_mm_cvtps_pd(_mm_movehl_ps(value, value)), va, vb);
+        _mm_storeu_ps(output + i, _mm_movelh_ps(_mm_cvtpd_ps(low), _mm_cvtpd_ps(high)));
+    }
+    return i;
+}
+
+template<bool Affine>
+__attribute__((target("avx2"))) static inline __m256d applyAvx2(__m256d value, __m256d a, __m256d b)
+{
+    value = _mm256_mul_pd(a, value);
+    if constexpr (Affine) {
+        value = _mm256_add_pd(value, b);
+    }
+    return value;
+}
+
+template<bool Affine>
+__attribute__((target("avx2"))) static qsizetype convertAvx2(const double *input, double *output, qsizetype size, double a, double b)
+{
+    const __m256d va = _mm256_set1_pd(a);
+    const __m256d vb = _mm256_set1_pd(b);
+    qsizetype i = 0;
+    for (; i + 4 <= size; i += 4) {
+        _mm256_storeu_pd(output + i, applyAvx2<Affine>(_mm256_loadu_pd(input + i), va, vb));
+    }
+    return i;
+}
+
+template<bool Affine>
+__attribute__((target("avx2"))) static qsizetype convertAvx2(const float *input, float *output, qsizetype size, double a, double b)
+{
+    const __m256d va = _mm256_set1_pd(a);
+    const __m256d vb = _mm256_set1_pd(b);
+    qsizetype i = 0;
+    for (; i + 4 <= size; i += 4) {
+        const __m256d value = applyAvx2<Affine>(_mm256_cvtps_pd(_mm_loadu_ps(input + i)), va, vb);
+        _mm_storeu_ps(output + i, _mm256_cvtpd_ps(value));
+    }
+    return i;
+}
+
+template<bool Affine>
+__attribute__((target("avx512f"))) static inline __m512d applyAvx512(__m512d value, __m512d a, __m512d b)
+{
+    value = _mm512_mul_pd(a, value);
+    if constexpr (Affine) {
+        value = _mm512_add_pd(value, b);
+    }
+    return value;
+}
+
+template<bool Affine>
+__attribute__((target("avx512f"))) static qsizetype convertAvx512(const double *input, double *output, qsizetype size, double a, double b)
+{
+    const __m512d va = _mm512_set1_pd(a);
+    const __m512d vb = _mm512_set1_pd(b);
+    qsizetype i = 0;
+    for (; i + 8 <= size; i += 8) {
+        _mm512_storeu_pd(output + i, applyAvx512<Affine>(_mm512_loadu_pd(input + i), va, vb));
+    }
+    return i;
+}
+
+template<bool Affine>
+__attribute__((target("avx512f"))) static qsizetype convertAvx512(const float *input, float *output, qsizetype size, double a, double b)
+{
+    const __m512d va = _mm512_set1_pd(a);
+    const __m512d vb = _mm512_set1_pd(b);
+    qsizetype i = 0;
+    for (; i + 8 <= size; i += 8) {
+        const __m512d value = applyAvx512<Affine>(_mm512_cvtps_pd(_mm256_loadu_ps(input + i)), va, vb);
+        _mm256_storeu_ps(output + i, _mm512_cvtpd_ps(value));
+    }
+    return i;
+}
+#endif
+
+static Level detectLevel()
+{
+#ifdef KUNITCONVERSION_X86_SIMD
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return Avx512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return Avx2;
+    }
+    return Sse2;
+#else
+    return Scalar;
+#endif
+}
+
+Level supportedLevel()
+{
+    static const Level level = detectLevel();
+    return level;
+}
+
+template<bool Affine, typename T>
+static void convert(Level level, const T *input, T *output, qsizetype size, double a, double b)
+{
+    qsizetype done = 0;
+#ifdef KUNITCONVERSION_X86_SIMD
+    switch (std::min(level, supportedLevel())) {
+    case Avx512:
+        done = convertAvx512<Affine>(input, output, size, a, b);
+        break;
+    case Avx2:
+        done = convertAvx2<Affine>(input, output, size, a, b);
+        break;
+    case Sse2:
+        done = convertSse2<Affine>(input, output, size, a, b);
+        break;
+    case Scalar:
+        break;
+    }
+#else
+    Q_UNUSED(level)
+#endif
+    convertScalar<Affine>(input + done, output + done, size - done, a, b);
+}
+
+void scale(Level level, const double *input, double *output, qsizetype size, double a)
+{
+    convert<false>(level, input, output, size, a, 0.0);
+}
+
+void scale(Level level, const float *input, float *output, qsizetype size, double a)
+{
+    convert<false>(level, input, output, size, a, 0.0);
+}
+
+void affine(Level level, const double *input, double *output, qsizetype size, double a, double b)
+{
+    convert<true>(level, input, output, size, a, b);
+}
+
+void affine(Level level, const float *input, float *output, qsizetype size, double a, double b)
+{
+    convert<true>(level, input, output, size, a, b);
+}
+}
+
+} // KUnitConversion namespace
@@ -0,0 +1,59 @@
+/*
+ *   SPDX-FileCopyrightText: 2026 KUnitConversion Authors
+ *
+ *   SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#ifndef KUNITCONVERSION_SIMDKERNELS_P_H
+#define KUNITCONVERSION_SIMDKERNELS_P_H
+
+#include "kunitconversion/kunitconversion_export.h"
+
+#include <QtGlobal>
+
+namespace KUnitConversion
+{
+/**
+ * Vectorized loops for scale and affine conversion kernels.
+ *
+ * All levels perform the same double precision operations per value and
+ * yield bit-identical results, they only differ in the number of values
+ * processed per instruction. Values of float ranges are converted in
+ * double precision and rounded once when stored.
+ *
+ * @internal exported for unit tests only
+ */
+namespace Simd
+{
+enum Level {
+    Scalar,
+    Sse2,
+    Avx2,
+    Avx512,
+};
+
+/**
+ * Highest level supported by both this build and the CPU we are running on.
+ */
+KUNITCONVERSION_EXPORT Level supportedLevel();
+
+/**
+ * output[i] = a * input[i]
+ *
+ * Levels above supportedLevel() fall back to the supported one.
+ */
+KUNITCONVERSION_EXPORT void scale(Level level, const double *input, double *output, qsizetype size, double a);
+KUNITCONVERSION_EXPORT void scale(Level level, const float *input, float *output, qsizetype size, double a);
+
+/**
+ * output[i] = a * input[i] + b
+ *
+ * Levels above supportedLevel() fall back to the supported one.
+ */
+KUNITCONVERSION_EXPORT void affine(Level level, const double *input, double *output, qsizetype size, double a, double b);
+KUNITCONVERSION_EXPORT void affine(Level level, const float *input, float *output, qsizetype size, double a, double b);
+}
+
+} // KUnitConversion namespace
+
+#endif // KUNITCONVERSION_SIMDKERNELS_P_H
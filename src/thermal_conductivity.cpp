@@ -20,7 +20,6 @@ UnitCategory ThermalConductivity::makeCategory()
 
     d->addDefaultUnit(UnitPrivate::makeUnit(ThermalConductivityCategory,
                               WattPerMeterKelvin,
-                              1,
                               i18nc("thermal conductivity unit symbol", "W/m·K"),
                               i18nc("unit description in lists", "watt per meter kelvin"),
                               i18nc("unit synonyms for matching user input", "watt per meter kelvin;watt per meter-kelvin;W/mK;W/m.K"),
@@ -30,7 +29,6 @@ UnitCategory ThermalConductivity::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(ThermalConductivityCategory,
                              BtuPerFootHourFahrenheit,
-                             0.5779,
                              i18nc("thermal conductivity unit symbol", "Btu/ft·hr·°F"),
                              i18nc("unit description in lists", "btu per foot hour degree Fahrenheit"),
                              i18nc("unit synonyms for matching user input",
@@ -41,7 +39,6 @@ UnitCategory ThermalConductivity::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(ThermalConductivityCategory,
                              BtuPerSquareFootHourFahrenheitPerInch,
-                             6.9348,
                              i18nc("thermal conductivity unit symbol", "Btu/ft²·hr·°F/in"),
                              i18nc("unit description in lists", "btu per square foot hour degree Fahrenheit per inch"),
                              i18nc("unit synonyms for matching user input",
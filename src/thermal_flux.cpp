@@ -21,7 +21,6 @@ UnitCategory ThermalFlux::makeCategory()
 
     d->addDefaultUnit(UnitPrivate::makeUnit(ThermalFluxCategory,
                               WattPerSquareMeter,
-                              1,
                               i18nc("thermal flux unit symbol", "W/m²"),
                               i18nc("unit description in lists", "watt per square meter"),
                               i18nc("unit synonyms for matching user input", "watt per square meter;W/m2;W/m^2"),
@@ -31,7 +30,6 @@ UnitCategory ThermalFlux::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(ThermalFluxCategory,
                              BtuPerHourPerSquareFoot,
-                             0.3169986,
                              i18nc("thermal flux unit symbol", "Btu/hr/ft²"),
                              i18nc("unit description in lists", "btu per hour per square foot"),
                              i18nc("unit synonyms for matching user input", "btu per hour per square foot;Btu/hr/ft2;Btu/hr/ft^2;Btu/ft^2/hr;Btu/ft2/hr"),
@@ -20,7 +20,6 @@ UnitCategory ThermalGeneration::makeCategory()
 
     d->addDefaultUnit(UnitPrivate::makeUnit(ThermalGenerationCategory,
                               WattPerCubicMeter,
-                              1,
                               i18nc("thermal generation unit symbol", "W/m³"),
                               i18nc("unit description in lists", "watt per cubic meter"),
                               i18nc("unit synonyms for matching user input", "watt per cubic meter;W/m3;W/m^3"),
@@ -30,7 +29,6 @@ UnitCategory ThermalGeneration::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(ThermalGenerationCategory,
                              BtuPerHourPerCubicFoot,
-                             0.09662,
                              i18nc("thermal generation unit symbol", "Btu/hr/ft³"),
                              i18nc("unit description in lists", "btu per hour per cubic foot"),
                              i18nc("unit synonyms for matching user input", "btu per hour per cubic foot;Btu/hr/ft3;Btu/hr/ft^3;Btu/ft^3/hr;Btu/ft3/hr"),
@@ -20,7 +20,6 @@ UnitCategory Time::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(TimeCategory,
                        Yottasecond,
-                       1e+24,
                        i18nc("time unit symbol", "Ys"),
                        i18nc("unit description in lists", "yottaseconds"),
                        i18nc("unit synonyms for matching user input", "yottasecond;yottaseconds;Ys"),
@@ -30,7 +29,6 @@ UnitCategory Time::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(TimeCategory,
                        Zettasecond,
-                       1e+21,
                        i18nc("time unit symbol", "Zs"),
                        i18nc("unit description in lists", "zettaseconds"),
                        i18nc("unit synonyms for matching user input", "zettasecond;zettaseconds;Zs"),
@@ -40,7 +38,6 @@ UnitCategory Time::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(TimeCategory,
                        Exasecond,
-                       1e+18,
                        i18nc("time unit symbol", "Es"),
                        i18nc("unit description in lists", "exaseconds"),
                        i18nc("unit synonyms for matching user input", "exasecond;exaseconds;Es"),
@@ -50,7 +47,6 @@ UnitCategory Time::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(TimeCategory,
                        Petasecond,
-                       1e+15,
                        i18nc("time unit symbol", "Ps"),
                        i18nc("unit description in lists", "petaseconds"),
                        i18nc("unit synonyms for matching user input", "petasecond;petaseconds;Ps"),
@@ -60,7 +56,6 @@ UnitCategory Time::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(TimeCategory,
                        Terasecond,
-                       1e+12,
                        i18nc("time unit symbol", "Ts"),
                        i18nc("unit description in lists", "teraseconds"),
                        i18nc("unit synonyms for matching user input", "terasecond;teraseconds;Ts"),
@@ -70,7 +65,6 @@ UnitCategory Time::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(TimeCategory,
                        Gigasecond,
-                       1e+09,
                        i18nc("time unit symbol", "Gs"),
                        i18nc("unit description in lists", "gigaseconds"),
                        i18nc("unit synonyms for matching user input", "gigasecond;gigaseconds;Gs"),
@@ -80,7 +74,6 @@ UnitCategory Time::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(TimeCategory,
                        Megasecond,
-                       1e+06,
                        i18nc("time unit symbol", "Ms"),
                        i18nc("unit description in lists", "megaseconds"),
                        i18nc("unit synonyms for matching user input", "megasecond;megaseconds;Ms"),
@@ -90,7 +83,6 @@ UnitCategory Time::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(TimeCategory,
                        Kilosecond,
-                       1000,
                        i18nc("time unit symbol", "ks"),
                        i18nc("unit description in lists", "kiloseconds"),
                        i18nc("unit synonyms for matching user input", "kilosecond;kiloseconds;ks"),
@@ -100,7 +92,6 @@ UnitCategory Time::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(TimeCategory,
                        Hectosecond,
-                       100,
                        i18nc("time unit symbol", "hs"),
                        i18nc("unit description in lists", "hectoseconds"),
                        i18nc("unit synonyms for matching user input", "hectosecond;hectoseconds;hs"),
@@ -110,7 +101,6 @@ UnitCategory Time::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(TimeCategory,
                        Decasecond,
-                       10,
                        i18nc("time unit symbol", "das"),
                        i18nc("unit description in lists", "decaseconds"),
                        i18nc("unit synonyms for matching user input", "decasecond;decaseconds;das"),
@@ -120,7 +110,6 @@ UnitCategory Time::makeCategory()
 
     d->addDefaultUnit(UnitPrivate::makeUnit(TimeCategory,
                               Second,
-                              1,
                               i18nc("time unit symbol", "s"),
                               i18nc("unit description in lists", "seconds"),
                               i18nc("unit synonyms for matching user input", "second;seconds;s"),
@@ -130,7 +119,6 @@ UnitCategory Time::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(TimeCategory,
                        Decisecond,
-                       0.1,
                        i18nc("time unit symbol", "ds"),
                        i18nc("unit description in lists", "deciseconds"),
                        i18nc("unit synonyms for matching user input", "decisecond;deciseconds;ds"),
@@ -140,7 +128,6 @@ UnitCategory Time::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(TimeCategory,
                        Centisecond,
-                       0.01,
                        i18nc("time unit symbol", "cs"),
                        i18nc("unit description in lists", "centiseconds"),
                        i18nc("unit synonyms for matching user input", "centisecond;centiseconds;cs"),
@@ -150,7 +137,6 @@ UnitCategory Time::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(TimeCategory,
                        Millisecond,
-                       0.001,
                        i18nc("time unit symbol", "ms"),
                        i18nc("unit description in lists", "milliseconds"),
                        i18nc("unit synonyms for matching user input", "millisecond;milliseconds;ms"),
@@ -160,7 +146,6 @@ UnitCategory Time::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(TimeCategory,
                        Microsecond,
-                       1e-06,
                        i18nc("time unit symbol", "µs"),
                        i18nc("unit description in lists", "microseconds"),
                        i18nc("unit synonyms for matching user input", "microsecond;microseconds;µs;us"),
@@ -170,7 +155,6 @@ UnitCategory Time::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(TimeCategory,
                        Nanosecond,
-                       1e-09,
                        i18nc("time unit symbol", "ns"),
                        i18nc("unit description in lists", "nanoseconds"),
                        i18nc("unit synonyms for matching user input", "nanosecond;nanoseconds;ns"),
@@ -180,7 +164,6 @@ UnitCategory Time::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(TimeCategory,
                        Picosecond,
-                       1e-12,
                        i18nc("time unit symbol", "ps"),
                        i18nc("unit description in lists", "picoseconds"),
                        i18nc("unit synonyms for matching user input", "picosecond;picoseconds;ps"),
@@ -190,7 +173,6 @@ UnitCategory Time::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(TimeCategory,
                        Femtosecond,
-                       1e-15,
                        i18nc("time unit symbol", "fs"),
                        i18nc("unit description in lists", "femtoseconds"),
                        i18nc("unit synonyms for matching user input", "femtosecond;femtoseconds;fs"),
@@ -200,7 +182,6 @@ UnitCategory Time::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(TimeCategory,
                        Attosecond,
-                       1e-18,
                        i18nc("time unit symbol", "as"),
                        i18nc("unit description in lists", "attoseconds"),
                        i18nc("unit synonyms for matching user input", "attosecond;attoseconds;as"),
@@ -210,7 +191,6 @@ UnitCategory Time::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(TimeCategory,
                        Zeptosecond,
-                       1e-21,
                        i18nc("time unit symbol", "zs"),
                        i18nc("unit description in lists", "zeptoseconds"),
                        i18nc("unit synonyms for matching user input", "zeptosecond;zeptoseconds;zs"),
@@ -220,7 +200,6 @@ UnitCategory Time::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(TimeCategory,
                        Yoctosecond,
-                       1e-24,
                        i18nc("time unit symbol", "ys"),
                        i18nc("unit description in lists", "yoctoseconds"),
                        i18nc("unit synonyms for matching user input", "yoctosecond;yoctoseconds;ys"),
@@ -230,7 +209,6 @@ UnitCategory Time::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(TimeCategory,
                              Minute,
-                             60,
                              i18nc("time unit symbol", "min"),
                              i18nc("unit description in lists", "minutes"),
                              i18nc("unit synonyms for matching user input", "minute;minutes;min"),
@@ -240,7 +218,6 @@ UnitCategory Time::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(TimeCategory,
                              Hour,
-                             3600,
                              i18nc("time unit symbol", "h"),
                              i18nc("unit description in lists", "hours"),
                              i18nc("unit synonyms for matching user input", "hour;hours;h"),
@@ -250,7 +227,6 @@ UnitCategory Time::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(TimeCategory,
                              Day,
-                             86400,
                              i18nc("time unit symbol", "d"),
                              i18nc("unit description in lists", "days"),
                              i18nc("unit synonyms for matching user input", "day;days;d"),
@@ -260,7 +236,6 @@ UnitCategory Time::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(TimeCategory,
                              Week,
-                             604800,
                              i18nc("time unit symbol", "w"),
                              i18nc("unit description in lists", "weeks"),
                              i18nc("unit synonyms for matching user input", "week;weeks"),
@@ -270,7 +245,6 @@ UnitCategory Time::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(TimeCategory,
                        JulianYear,
-                       3.15576e+07,
                        i18nc("time unit symbol", "a"),
                        i18nc("unit description in lists", "Julian years"),
                        i18nc("unit synonyms for matching user input", "Julian year;Julian years;a"),
@@ -280,7 +254,6 @@ UnitCategory Time::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(TimeCategory,
                        LeapYear,
-                       3.16224e+07,
                        i18nc("time unit symbol", "lpy"),
                        i18nc("unit description in lists", "leap years"),
                        i18nc("unit synonyms for matching user input", "leap year;leap years"),
@@ -291,7 +264,6 @@ UnitCategory Time::makeCategory()
     // Let's say we call that a normal year
     d->addCommonUnit(UnitPrivate::makeUnit(TimeCategory,
                              Year,
-                             3.1536e+07,
                              i18nc("time unit symbol", "y"),
                              i18nc("unit description in lists", "year"),
                              i18nc("unit synonyms for matching user input", "year;years;y"),
@@ -299,6 +271,36 @@ UnitCategory Time::makeCategory()
                              ki18nc("amount in units (real)", "%1 year"),
                              ki18ncp("amount in units (integer)", "%1 year", "%1 years")));
 
+    // beyond seconds the common units read better than SI prefixes
+    d->addUnitLadder({Yoctosecond,
+                      Zeptosecond,
+                      Attosecond,
+                      Femtosecond,
+                      Picosecond,
+                      Nanosecond,
+                      Microsecond,
+                      Millisecond,
+                      Second,
+                      Minute,
+                      Hour,
+                      Day,
+                      Year},
+                     {Centisecond,
+                      Decisecond,
+                      Decasecond,
+                      Hectosecond,
+                      Kilosecond,
+                      Megasecond,
+                      Gigasecond,
+                      Terasecond,
+                      Petasecond,
+                      Exasecond,
+                      Zettasecond,
+                      Yottasecond,
+                      Week,
+                      JulianYear,
+                      LeapYear});
+
     return c;
 }
 
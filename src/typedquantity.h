@@ -0,0 +1,280 @@
+/*
+ *   SPDX-FileCopyrightText: 2026 KUnitConversion Authors
+ *
+ *   SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#ifndef KUNITCONVERSION_TYPEDQUANTITY_H
+#define KUNITCONVERSION_TYPEDQUANTITY_H
+
+#include "quantity.h"
+#include "unittable.h"
+#include "value.h"
+
+#if defined(__cpp_impl_three_way_comparison)
+#include <compare>
+#endif
+
+namespace KUnitConversion
+{
+/*!
+ * \class KUnitConversion::TypedQuantity
+ * \inmodule KUnitConversion
+ * \inheaderfile KUnitConversion/TypedQuantity
+ *
+ * \brief Number in a unit known at compile time.
+ *
+ * A typed quantity is just a number, its category \a Category and unit
+ * \a UnitIdentifier are template arguments. Conversions between units are
+ * resolved at compile time with convert(), and mixing quantities of different
+ * categories, or units that can only be converted at runtime, fails to
+ * compile. There are no validity checks and no lookups at runtime.
+ *
+ * Quantities of the same category convert implicitly:
+ *
+ * \code
+ * using Meters = KUnitConversion::TypedQuantity<KUnitConversion::LengthCategory, KUnitConversion::Meter>;
+ * using Miles = KUnitConversion::TypedQuantity<KUnitConversion::LengthCategory, KUnitConversion::Mile>;
+ * constexpr Meters distance = Miles(26.2) + Meters(195.0);
+ * \endcode
+ *
+ * Use toValue() or Quantity to hand the number to code working with units
+ * known at runtime only, and fromValue() or fromQuantity() for the way back.
+ *
+ * \sa Quantity, convert()
+ * \since 6.28
+ */
+template<CategoryId Category, UnitId UnitIdentifier>
+class TypedQuantity
+{
+    static_assert(unitDefinition(UnitIdentifier) != nullptr, "the unit needs a definition, currencies have none");
+    static_assert(unitDefinition(UnitIdentifier)->categoryId == Category, "the unit does not belong to the category");
+
+public:
+    /*!
+     * Creates a quantity of 0 in the unit of the quantity.
+     */
+    constexpr TypedQuantity() noexcept = default;
+
+    /*!
+     * Creates a quantity of \a number in the unit of the quantity.
+     */
+    constexpr explicit TypedQuantity(qreal number) noexcept
+        : m_number(number)
+    {
+    }
+
+    /*!
+     * Creates a quantity from \a other, converting it to the unit of the
+     * quantity at compile time.
+     */
+    template<UnitId OtherUnit>
+    constexpr TypedQuantity(TypedQuantity<Category, OtherUnit> other) noexcept
+        : m_number(convert<OtherUnit, UnitIdentifier>(other.number()))
+    {
+    }
+
+    /*!
+     * Converts \a value to the unit of the quantity at runtime.
+     *
+     * The number is NaN if \a value is invalid or of another category.
+     */
+    static TypedQuantity fromValue(const Value &value)
+    {
+        const Value converted = value.convertTo(UnitIdentifier);
+        return TypedQuantity(converted.isValid() ? converted.number() : qQNaN());
+    }
+
+    /*!
+     * Converts \a quantity to the unit of the quantity at runtime.
+     *
+     * The number is NaN if \a quantity is invalid or of another category.
+     */
+    static TypedQuantity fromQuantity(const Quantity &quantity)
+    {
+        return TypedQuantity(quantity.unitId() == UnitIdentifier ? quantity.number() : quantity.convertTo(UnitIdentifier).number());
+    }
+
+    /*!
+     * Number part of the quantity
+     **/
+    constexpr qreal number() const noexcept
+    {
+        return m_number;
+    }
+
+    /*!
+     * Category of the quantity
+     **/
+    static constexpr CategoryId categoryId() noexcept
+    {
+        return Category;
+    }
+
+    /*!
+     * Id of the unit of the quantity
+     **/
+    static constexpr UnitId unitId() noexcept
+    {
+        return UnitIdentifier;
+    }
+
+    /*!
+     * Convert to the unit \a ToUnit at compile time.
+     **/
+    template<UnitId ToUnit>
+    constexpr TypedQuantity<Category, ToUnit> convertTo() const noexcept
+    {
+        return TypedQuantity<Category, ToUnit>(convert<UnitIdentifier, ToUnit>(m_number));
+    }
+
+    /*!
+     * Returns the quantity as a Quantity.
+     */
+    constexpr operator Quantity() const noexcept
+    {
+        return Quantity(m_number, UnitIdentifier);
+    }
+
+    /*!
+     * Returns the quantity as a Value.
+     */
+    Value toValue() const
+    {
+        return Value(m_number, UnitIdentifier);
+    }
+
+    /*!
+     * Adds \a other, converted to the unit of the quantity.
+     **/
+    template<UnitId OtherUnit>
+    constexpr TypedQuantity &operator+=(TypedQuantity<Category, OtherUnit> other) noexcept
+    {
+        m_number += convert<OtherUnit, UnitIdentifier>(other.number());
+        return *this;
+    }
+
+    /*!
+     * Subtracts \a other, converted to the unit of the quantity.
+     **/
+    template<UnitId OtherUnit>
+    constexpr TypedQuantity &operator-=(TypedQuantity<Category, OtherUnit> other) noexcept
+    {
+        m_number -= convert<OtherUnit, UnitIdentifier>(other.number());
+        return *this;
+    }
+
+    constexpr TypedQuantity &operator*=(qreal factor) noexcept
+    {
+        m_number *= factor;
+        return *this;
+    }
+
+    constexpr TypedQuantity &operator/=(qreal divisor) noexcept
+    {
+        m_number /= divisor;
+        return *this;
+    }
+
+    /*!
+     * Returns the sum of \a lhs and \a rhs in the unit of \a lhs.
+     **/
+    template<UnitId OtherUnit>
+    friend constexpr TypedQuantity operator+(TypedQuantity lhs, TypedQuantity<Category, OtherUnit> rhs) noexcept
+    {
+        return lhs += rhs;
+    }
+
+    /*!
+     * Returns the difference of \a lhs and \a rhs in the unit of \a lhs.
+     **/
+    template<UnitId OtherUnit>
+    friend constexpr TypedQuantity operator-(TypedQuantity lhs, TypedQuantity<Category, OtherUnit> rhs) noexcept
+    {
+        return lhs -= rhs;
+    }
+
+    friend constexpr TypedQuantity operator-(TypedQuantity quantity) noexcept
+    {
+        return TypedQuantity(-quantity.m_number);
+    }
+
+    friend constexpr TypedQuantity operator*(TypedQuantity quantity, qreal factor) noexcept
+    {
+        return quantity *= factor;
+    }
+
+    friend constexpr TypedQuantity operator*(qreal factor, TypedQuantity quantity) noexcept
+    {
+        return quantity *= factor;
+    }
+
+    friend constexpr TypedQuantity operator/(TypedQuantity quantity, qreal divisor) noexcept
+    {
+        return quantity /= divisor;
+    }
+
+    /*!
+     * Returns the ratio of the amounts of \a lhs and \a rhs.
+     **/
+    template<UnitId OtherUnit>
+    friend constexpr qreal operator/(TypedQuantity lhs, TypedQuantity<Category, OtherUnit> rhs) noexcept
+    {
+        return lhs.m_number / convert<OtherUnit, UnitIdentifier>(rhs.number());
+    }
+
+    /*!
+     * Compares the amounts of \a lhs and \a rhs, converting \a rhs to the
+     * unit of \a lhs first.
+     **/
+    template<UnitId OtherUnit>
+    friend constexpr bool operator==(TypedQuantity lhs, TypedQuantity<Category, OtherUnit> rhs) noexcept
+    {
+        return lhs.m_number == convert<OtherUnit, UnitIdentifier>(rhs.number());
+    }
+
+    template<UnitId OtherUnit>
+    friend constexpr bool operator!=(TypedQuantity lhs, TypedQuantity<Category, OtherUnit> rhs) noexcept
+    {
+        return lhs.m_number != convert<OtherUnit, UnitIdentifier>(rhs.number());
+    }
+
+    template<UnitId OtherUnit>
+    friend constexpr bool operator<(TypedQuantity lhs, TypedQuantity<Category, OtherUnit> rhs) noexcept
+    {
+        return lhs.m_number < convert<OtherUnit, UnitIdentifier>(rhs.number());
+    }
+
+    template<UnitId OtherUnit>
+    friend constexpr bool operator<=(TypedQuantity lhs, TypedQuantity<Category, OtherUnit> rhs) noexcept
+    {
+        return lhs.m_number <= convert<OtherUnit, UnitIdentifier>(rhs.number());
+    }
+
+    template<UnitId OtherUnit>
+    friend constexpr bool operator>(TypedQuantity lhs, TypedQuantity<Category, OtherUnit> rhs) noexcept
+    {
+        return lhs.m_number > convert<OtherUnit, UnitIdentifier>(rhs.number());
+    }
+
+    template<UnitId OtherUnit>
+    friend constexpr bool operator>=(TypedQuantity lhs, TypedQuantity<Category, OtherUnit> rhs) noexcept
+    {
+        return lhs.m_number >= convert<OtherUnit, UnitIdentifier>(rhs.number());
+    }
+
+#if defined(__cpp_impl_three_way_comparison)
+    template<UnitId OtherUnit>
+    friend constexpr std::partial_ordering operator<=>(TypedQuantity lhs, TypedQuantity<Category, OtherUnit> rhs) noexcept
+    {
+        return lhs.m_number <=> convert<OtherUnit, UnitIdentifier>(rhs.number());
+    }
+#endif
+
+private:
+    qreal m_number = 0.0;
+};
+
+} // KUnitConversion namespace
+
+#endif // KUNITCONVERSION_TYPEDQUANTITY_H
@@ -8,11 +8,123 @@
 #include "unit.h"
 #include "unit_p.h"
 #include "unitcategory.h"
+#include "unittable.h"
 
 #include <KLocalizedString>
 
+#include <charconv>
+
 namespace KUnitConversion
 {
+// a noncharacter, so it cannot clash with anything in a translation
+static constexpr QStringView formatMarker = u"\uFDD0";
+
+// fits the fixed notation of any double, the smallest denormal needs 327 characters
+static constexpr int ShortestNumberBufferSize = 400;
+
+void UnitFormat::appendNumber(QString &buffer, qreal value, int fieldWidth, char format, int precision, const QChar &fillChar) const
+{
+    if (fieldWidth == 0) {
+        if (precision == QLocale::FloatingPointShortest) {
+            appendShortestNumber(buffer, value, format);
+        } else {
+            buffer.append(locale.toString(value, format, precision));
+        }
+        return;
+    }
+    // same as KLocalizedString::subs(), which also handles zero padding after the sign
+    buffer.append(QStringLiteral("%L1").arg(value, fieldWidth, format, precision, fillChar));
+}
+
+void UnitFormat::appendShortestNumber(QString &buffer, qreal value, char format) const
+{
+    if (!qIsFinite(value) || zeroDigit == 0) {
+        buffer.append(locale.toString(value, format, QLocale::FloatingPointShortest));
+        return;
+    }
+
+    std::chars_format charsFormat = std::chars_format::general;
+    if (format == 'f' || format == 'F') {
+        charsFormat = std::chars_format::fixed;
+    } else if (format == 'e' || format == 'E') {
+        charsFormat = std::chars_format::scientific;
+    }
+    char digits[ShortestNumberBufferSize];
+    const char *end = std::to_chars(digits, digits + sizeof(digits), value, charsFormat).ptr;
+
+    // to_chars always uses the C locale, only the symbols need replacing
+    for (const char *c = digits; c < end; ++c) {
+        switch (*c) {
+        case '.':
+            buffer.append(decimalPoint);
+            break;
+        case '-':
+            buffer.append(negativeSign);
+            break;
+        case '+':
+            buffer.append(positiveSign);
+            break;
+        case 'e':
+            buffer.append(format == 'E' || format == 'G' ? exponential.toUpper() : exponential);
+            // the exponent has a sign and at least two digits
+            buffer.append(c[1] == '-' ? negativeSign : positiveSign);
+            c += 1;
+            if (omitLeadingZeroInExponent && c[1] == '0' && c + 2 < end) {
+                c += 1;
+            }
+            break;
+        default:
+            buffer.append(QChar(char16_t(zeroDigit + (*c - '0'))));
+            break;
+        }
+    }
+}
+
+UnitFormatTemplate UnitFormatTemplate::fromString(const QString &text, QStringView marker)
+{
+    const qsizetype pos = text.indexOf(marker);
+    if (pos < 0 || text.indexOf(marker, pos + marker.size()) >= 0) {
+        return UnitFormatTemplate();
+    }
+    return UnitFormatTemplate{text.first(pos), text.sliced(pos + marker.size()), true};
+}
+
+const UnitFormat *UnitFormatCache::format(const UnitPrivate &unit)
+{
+    const QLocale locale;
+    // the templates change with KLocalizedString::setLanguages() as well
+    const QStringList languages = KLocalizedString::languages();
+    if (const UnitFormat *format = m_format.loadAcquire(); format && format->locale == locale && format->languages == languages) {
+        return format;
+    }
+
+    QMutexLocker locker(&m_mutex);
+    for (const auto &format : m_formats) {
+        if (format->locale == locale && format->languages == languages) {
+            m_format.storeRelease(format.get());
+            return format.get();
+        }
+    }
+
+    auto format = std::make_unique<UnitFormat>();
+    format->locale = locale;
+    format->languages = languages;
+    format->decimalPoint = locale.decimalPoint();
+    format->negativeSign = locale.negativeSign();
+    format->positiveSign = locale.positiveSign();
+    format->exponential = locale.exponential();
+    if (const QString zeroDigit = locale.zeroDigit(); zeroDigit.size() == 1) {
+        format->zeroDigit = zeroDigit.at(0).unicode();
+    }
+    format->omitLeadingZeroInExponent = locale.numberOptions().testFlag(QLocale::OmitLeadingZeroInExponent);
+    const QString marker = formatMarker.toString();
+    format->symbolString = UnitFormatTemplate::fromString(unit.m_symbolString.subs(marker).subs(unit.m_symbol).toString(), formatMarker);
+    format->realString = UnitFormatTemplate::fromString(unit.m_realString.subs(marker).toString(), formatMarker);
+    m_format.storeRelease(format.get());
+    m_formats.push_back(std::move(format));
+    return m_formats.back().get();
+}
+
 UnitPrivate::UnitPrivate()
     : m_categoryId(InvalidCategory)
     , m_id(InvalidUnit)
@@ -20,6 +132,36 @@ UnitPrivate::UnitPrivate()
 {
 }
 
+UnitPrivate::UnitPrivate(CategoryId categoryId,
+                         UnitId id,
+                         const QString &symbol,
+                         const QString &description,
+                         const QString &matchString,
+                         const KLocalizedString &symbolString,
+                         const KLocalizedString &realString,
+                         const KLocalizedString &integerString)
+    : UnitPrivate(categoryId, id, qQNaN(), symbol, description, matchString, symbolString, realString, integerString)
+{
+    const UnitDefinition *definition = unitDefinition(id);
+    Q_ASSERT_X(definition && definition->categoryId == categoryId, "UnitPrivate", "unit without a definition in unittable.h");
+    if (!definition) {
+        return;
+    }
+    switch (definition->kind) {
+    case UnitDefinition::Linear:
+        m_kind = UnitTransform::Linear;
+        break;
+    case UnitDefinition::Reciprocal:
+        m_kind = UnitTransform::Reciprocal;
+        break;
+    case UnitDefinition::Other:
+        m_kind = UnitTransform::Other;
+        break;
+    }
+    m_multiplier = definition->scale;
+    m_offset = definition->offset;
+}
+
 UnitPrivate::UnitPrivate(CategoryId categoryId,
                          UnitId id,
                          qreal multiplier,
@@ -72,12 +214,34 @@ qreal UnitPrivate::unitMultiplier() const
 
 qreal UnitPrivate::toDefault(qreal value) const
 {
-    return value * m_multiplier;
+    switch (m_kind) {
+    case UnitTransform::Linear:
+        // adding an offset of 0 would turn -0 into 0
+        return m_offset == 0.0 ? value * m_multiplier : value * m_multiplier + m_offset;
+    case UnitTransform::Reciprocal:
+        return m_multiplier / value;
+    case UnitTransform::Other:
+        break;
+    }
+    return qQNaN();
 }
 
 qreal UnitPrivate::fromDefault(qreal value) const
 {
-    return value / m_multiplier;
+    switch (m_kind) {
+    case UnitTransform::Linear:
+        return m_offset == 0.0 ? value / m_multiplier : (value - m_offset) / m_multiplier;
+    case UnitTransform::Reciprocal:
+        return m_multiplier / value;
+    case UnitTransform::Other:
+        break;
+    }
+    return qQNaN();
+}
+
+UnitTransform UnitPrivate::transform() const
+{
+    return {m_kind, m_multiplier, m_offset};
 }
 
 Unit::Unit()
@@ -203,22 +367,52 @@ qreal Unit::fromDefault(qreal value) const
 }
 
 QString Unit::toString(qreal value, int fieldWidth, char format, int precision, const QChar &fillChar) const
+{
+    QString string;
+    appendString(string, value, fieldWidth, format, precision, fillChar);
+    return string;
+}
+
+QString Unit::toSymbolString(qreal value, int fieldWidth, char format, int precision, const QChar &fillChar) const
+{
+    QString string;
+    appendSymbolString(string, value, fieldWidth, format, precision, fillChar);
+    return string;
+}
+
+void Unit::appendString(QString &buffer, qreal value, int fieldWidth, char format, int precision, const QChar &fillChar) const
 {
     if (isNull()) {
-        return QString();
+        return;
     }
     if ((int)value == value && precision < 1) {
-        return d->m_integerString.subs((int)value).toString();
+        // plural forms depend on both the number and the language, leave them to KLocalizedString
+        buffer.append(d->m_integerString.subs((int)value).toString());
+        return;
+    }
+    const UnitFormat *unitFormat = d->m_formatCache.format(*d);
+    if (!unitFormat->realString.isValid) {
+        buffer.append(d->m_realString.subs(value, fieldWidth, format, precision, fillChar).toString());
+        return;
     }
-    return d->m_realString.subs(value, fieldWidth, format, precision, fillChar).toString();
+    buffer.append(unitFormat->realString.prefix);
+    unitFormat->appendNumber(buffer, value, fieldWidth, format, precision, fillChar);
+    buffer.append(unitFormat->realString.suffix);
 }
 
-QString Unit::toSymbolString(qreal value, int fieldWidth, char format, int precision, const QChar &fillChar) const
+void Unit::appendSymbolString(QString &buffer, qreal value, int fieldWidth, char format, int precision, const QChar &fillChar) const
 {
-    if (d) {
-        return d->m_symbolString.subs(value, fieldWidth, format, precision, fillChar).subs(d->m_symbol).toString();
+    if (isNull()) {
+        return;
     }
-    return QString();
+    const UnitFormat *unitFormat = d->m_formatCache.format(*d);
+    if (!unitFormat->symbolString.isValid) {
+        buffer.append(d->m_symbolString.subs(value, fieldWidth, format, precision, fillChar).subs(d->m_symbol).toString());
+        return;
+    }
+    buffer.append(unitFormat->symbolString.prefix);
+    unitFormat->appendNumber(buffer, value, fieldWidth, format, precision, fillChar);
+    buffer.append(unitFormat->symbolString.suffix);
 }
 
 }
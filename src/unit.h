@@ -1315,11 +1315,18 @@ public:
      *
      * \a format type of floating point formatting, like in \l QString::arg
      *
-     * \a precision number of digits after the decimal separator
+     * \a precision number of digits after the decimal separator, or
+     *                  QLocale::FloatingPointShortest for the fewest digits
+     *                  that still read back as exactly \a value
      *
      * \a fillChar the character used to fill up the empty places when
      *                 field width is greater than argument width
      *
+     * With QLocale::FloatingPointShortest and no \a fieldWidth the number is
+     * written without group separators, using the decimal point, signs,
+     * exponent and digits of the default locale. This is the fastest form and
+     * loses nothing, which makes it suitable for exporting many values.
+     *
      * Returns value + unit string
      **/
     QString toString(qreal value, int fieldWidth = 0, char format = 'g', int precision = -1, const QChar &fillChar = QLatin1Char(' ')) const;
@@ -1332,7 +1339,8 @@ public:
      *
      * \a format type of floating point formatting, like in \l QString::arg
      *
-     * \a precision number of digits after the decimal separator
+     * \a precision number of digits after the decimal separator, or
+     *                  QLocale::FloatingPointShortest, see toString()
      *
      * \a fillChar the character used to fill up the empty places when
      *                 field width is greater than argument width
@@ -1341,6 +1349,38 @@ public:
      **/
     QString toSymbolString(qreal value, int fieldWidth = 0, char format = 'g', int precision = -1, const QChar &fillChar = QLatin1Char(' ')) const;
 
+    /*!
+     * Appends the same text as toString() to \a buffer, for building large
+     * texts such as tables of values without a temporary string per value.
+     *
+     * The translated format is resolved once per default locale and reused.
+     *
+     * \sa toString()
+     * \since 6.28
+     **/
+    void appendString(QString &buffer,
+                      qreal value,
+                      int fieldWidth = 0,
+                      char format = 'g',
+                      int precision = -1,
+                      const QChar &fillChar = QLatin1Char(' ')) const;
+
+    /*!
+     * Appends the same text as toSymbolString() to \a buffer, for building
+     * large texts such as tables of values without a temporary string per value.
+     *
+     * The translated format is resolved once per default locale and reused.
+     *
+     * \sa toSymbolString()
+     * \since 6.28
+     **/
+    void appendSymbolString(QString &buffer,
+                            qreal value,
+                            int fieldWidth = 0,
+                            char format = 'g',
+                            int precision = -1,
+                            const QChar &fillChar = QLatin1Char(' ')) const;
+
 protected:
     qreal toDefault(qreal value) const;
     qreal fromDefault(qreal value) const;
@@ -14,13 +14,108 @@
 
 #include <KLocalizedString>
 
+#include <QAtomicPointer>
+#include <QLocale>
+#include <QMutex>
+#include <QStringList>
+
+#include <memory>
+#include <vector>
+
 namespace KUnitConversion
 {
+/**
+ * Describes the mapping done by UnitPrivate::toDefault(), so that the conversion
+ * between two units can be folded into a single operation ahead of time.
+ */
+struct UnitTransform {
+    enum Kind {
+        Linear, //!< toDefault(x) = scale * x + offset
+        Reciprocal, //!< toDefault(x) = scale / x
+        Other, //!< only available through toDefault() and fromDefault()
+    };
+
+    Kind kind = Other;
+    qreal scale = 1.0;
+    qreal offset = 0.0;
+};
+
+/**
+ * A translated format string split around the number placeholder.
+ */
+struct UnitFormatTemplate {
+    /** Splits @p text at @p marker, invalid unless the marker occurs exactly once. */
+    static UnitFormatTemplate fromString(const QString &text, QStringView marker);
+
+    QString prefix;
+    QString suffix;
+    bool isValid = false;
+};
+
+/**
+ * The formats of a unit resolved for one locale and set of translation languages.
+ */
+struct UnitFormat {
+    /** Appends @p value the way KLocalizedString::subs() formats it, see Unit::toString() for the shortest form. */
+    void appendNumber(QString &buffer, qreal value, int fieldWidth, char format, int precision, const QChar &fillChar) const;
+
+    /** Appends the shortest form of @p value that reads back as exactly @p value. */
+    void appendShortestNumber(QString &buffer, qreal value, char format) const;
+
+    QLocale locale;
+    QStringList languages; //!< KLocalizedString::languages() the templates are translated for
+    QString decimalPoint;
+    QString negativeSign;
+    QString positiveSign;
+    QString exponential;
+    char16_t zeroDigit = 0; //!< 0 if the digits of the locale are not single UTF-16 code units
+    bool omitLeadingZeroInExponent = false;
+    UnitFormatTemplate symbolString; //!< the symbol is already substituted
+    UnitFormatTemplate realString;
+};
+
+class UnitPrivate;
+
+/**
+ * Resolves the formats of a unit once per default locale and translation
+ * languages instead of on every call. Published formats are immutable and kept until the unit is deleted,
+ * so they can be used without locking.
+ */
+class UnitFormatCache
+{
+public:
+    UnitFormatCache() = default;
+    // a copy resolves its formats again
+    UnitFormatCache(const UnitFormatCache &)
+    {
+    }
+    UnitFormatCache &operator=(const UnitFormatCache &) = delete;
+
+    /** Formats of @p unit for the current default locale and translation languages. */
+    const UnitFormat *format(const UnitPrivate &unit);
+
+private:
+    QMutex m_mutex; //!< serializes resolving formats
+    QAtomicPointer<const UnitFormat> m_format;
+    std::vector<std::unique_ptr<const UnitFormat>> m_formats; //!< every published format, callers may still use older ones
+};
+
 class UnitPrivate : public QSharedData
 {
 public:
     UnitPrivate();
 
+    /** Unit converting as its UnitDefinition in unittable.h describes. */
+    UnitPrivate(CategoryId categoryId,
+                UnitId id,
+                const QString &symbol,
+                const QString &description,
+                const QString &matchString,
+                const KLocalizedString &symbolString,
+                const KLocalizedString &realString,
+                const KLocalizedString &integerString);
+
+    /** Linear unit without a UnitDefinition, i.e. a currency. */
     UnitPrivate(CategoryId categoryId,
                 UnitId id,
                 qreal multiplier,
@@ -42,6 +137,7 @@ public:
 
     virtual qreal toDefault(qreal value) const;
     virtual qreal fromDefault(qreal value) const;
+    virtual UnitTransform transform() const;
 
     static inline Unit makeUnit(UnitPrivate *dd)
     {
@@ -59,17 +155,33 @@ public:
     {
         return Unit(new UnitPrivate(categoryId, id, multiplier, symbol, description, matchString, symbolString, realString, integerString));
     }
+    static inline Unit makeUnit(CategoryId categoryId,
+                                UnitId id,
+                                const QString &symbol,
+                                const QString &description,
+                                const QString &matchString,
+                                const KLocalizedString &symbolString,
+                                const KLocalizedString &realString,
+                                const KLocalizedString &integerString)
+    {
+        return Unit(new UnitPrivate(categoryId, id, symbol, description, matchString, symbolString, realString, integerString));
+    }
 
     CategoryId m_categoryId;
     UnitId m_id;
+    UnitTransform::Kind m_kind = UnitTransform::Linear;
     qreal m_multiplier;
+    qreal m_offset = 0.0; //!< added to the number in this unit times m_multiplier
     QString m_symbol;
     QString m_description;
     QString m_matchString;
     KLocalizedString m_symbolString;
     KLocalizedString m_realString;
     KLocalizedString m_integerString;
+    UnitFormatCache m_formatCache;
+    PublishedTable<MixedTable> m_mixedTable; //!< conversions from all units of m_category to this one
     UnitCategoryPrivate *m_category = nullptr; // emulating a weak_ptr, as we otherwise have an undeleteable reference cycle
+    qsizetype m_categoryIndex = -1; //!< position in the units of m_category
 };
 
 } // KUnitConversion namespace
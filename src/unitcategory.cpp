@@ -6,6 +6,8 @@
  */
 
 #include "unitcategory.h"
+#include "converter_p.h"
+#include "simdkernels_p.h"
 #include "unit_p.h"
 #include "unitcategory_p.h"
 
@@ -16,6 +18,9 @@
 #include <QNetworkAccessManager>
 #include <QStandardPaths>
 
+#include <algorithm>
+#include <cmath>
+
 namespace KUnitConversion
 {
 UnitCategoryPrivate::UnitCategoryPrivate()
@@ -61,10 +66,152 @@ QNetworkAccessManager *UnitCategoryPrivate::nam()
     return s_nam.get();
 }
 
-Value UnitCategoryPrivate::convert(const Value &value, const Unit &toUnit)
+qreal UnitCategoryPrivate::convert(const Unit &fromUnit, const Unit &toUnit, qreal value)
+{
+    // not through the factor matrix, Value::convertTo() has always rounded
+    // after each of toDefault() and fromDefault()
+    return toUnit.fromDefault(fromUnit.toDefault(value));
+}
+
+void UnitCategoryPrivate::convert(const Unit &fromUnit, const Unit &toUnit, QSpan<const qreal> input, QSpan<qreal> output)
+{
+    conversionKernel(fromUnit, toUnit).apply(input, output);
+}
+
+void UnitCategoryPrivate::convert(const Unit &fromUnit, const Unit &toUnit, QSpan<const float> input, QSpan<float> output)
+{
+    conversionKernel(fromUnit, toUnit).apply(input, output);
+}
+
+ConversionKernel UnitCategoryPrivate::conversionKernel(const Unit &fromUnit, const Unit &toUnit)
+{
+    if (const std::optional<qreal> factor = this->factor(fromUnit, toUnit)) {
+        ConversionKernel kernel;
+        kernel.m_kind = ConversionKernel::Scale;
+        kernel.m_a = *factor;
+        kernel.m_from = fromUnit.d.data();
+        kernel.m_to = toUnit.d.data();
+        return kernel;
+    }
+    return ConversionKernel(fromUnit.d.data(), toUnit.d.data());
+}
+
+void UnitCategoryPrivate::convertToAll(const Unit &fromUnit, qreal number, QSpan<const Unit> units, QSpan<qreal> output)
+{
+    if (const FactorMatrix *matrix = factorMatrix(); matrix && fromUnit.d->m_category == this) {
+        // the row of the matrix holds the factors to all units in their order
+        const qreal *row = matrix->factors.constData() + fromUnit.d->m_categoryIndex * matrix->size;
+        if (units.data() == m_units.constData() && units.size() == matrix->size) {
+            Simd::scale(Simd::supportedLevel(), row, output.data(), units.size(), number);
+            return;
+        }
+        for (qsizetype i = 0; i < units.size(); ++i) {
+            output[i] = row[units[i].d->m_categoryIndex] * number;
+        }
+        return;
+    }
+
+    const qreal defaultNumber = fromUnit.toDefault(number);
+    for (qsizetype i = 0; i < units.size(); ++i) {
+        output[i] = units[i].fromDefault(defaultNumber);
+    }
+}
+
+const FactorMatrix *UnitCategoryPrivate::factorMatrix()
+{
+    const FactorMatrix *matrix = m_factorMatrix.table();
+    if (!matrix) {
+        auto built = std::make_unique<FactorMatrix>();
+        QList<qreal> scales;
+        scales.reserve(m_units.size());
+        for (const Unit &unit : std::as_const(m_units)) {
+            const UnitTransform transform = unit.d->transform();
+            if (transform.kind != UnitTransform::Linear || transform.offset != 0.0) {
+                scales.clear();
+                break;
+            }
+            scales.append(transform.scale);
+        }
+        built->size = scales.size();
+        built->factors.resize(scales.size() * scales.size());
+        for (qsizetype from = 0; from < scales.size(); ++from) {
+            for (qsizetype to = 0; to < scales.size(); ++to) {
+                // divided in extended precision, so that the factor is the exact quotient
+                // rounded to qreal wherever long double is wider than double
+                built->factors[from * scales.size() + to] = qreal(static_cast<long double>(scales[from]) / scales[to]);
+            }
+        }
+        matrix = m_factorMatrix.publish(std::move(built));
+    }
+    return matrix->size > 0 ? matrix : nullptr;
+}
+
+std::optional<qreal> UnitCategoryPrivate::factor(const Unit &fromUnit, const Unit &toUnit)
+{
+    if (!fromUnit.d || !toUnit.d || fromUnit.d->m_category != this || toUnit.d->m_category != this) {
+        return std::nullopt;
+    }
+    const FactorMatrix *matrix = factorMatrix();
+    if (!matrix) {
+        return std::nullopt;
+    }
+    return matrix->factor(fromUnit.d->m_categoryIndex, toUnit.d->m_categoryIndex);
+}
+
+ConversionKernel UnitCategoryPrivate::kernelFor(const Unit &fromUnit, const Unit &toUnit)
+{
+    if (fromUnit.isValid() && toUnit.isValid() && fromUnit.d->m_category && fromUnit.d->m_category == toUnit.d->m_category) {
+        return fromUnit.d->m_category->conversionKernel(fromUnit, toUnit);
+    }
+    return ConversionKernel();
+}
+
+Value UnitCategoryPrivate::convertValue(const Unit &fromUnit, qreal number, const Unit &toUnit)
+{
+    if (!fromUnit.isValid() || !fromUnit.d->m_category || !toUnit.isValid()) {
+        return Value();
+    }
+    return Value(fromUnit.d->m_category->convert(fromUnit, toUnit, number), toUnit);
+}
+
+Value UnitCategoryPrivate::convertValue(const Unit &fromUnit, qreal number, UnitId toUnit)
+{
+    if (!fromUnit.isValid() || !fromUnit.d->m_category) {
+        return Value();
+    }
+    const Unit *to = ConverterPrivate::instance()->unit(toUnit);
+    if (!to || to->d->m_category != fromUnit.d->m_category) {
+        return Value();
+    }
+    return convertValue(fromUnit, number, *to);
+}
+
+qreal UnitCategoryPrivate::convertNumber(const Unit &fromUnit, qreal number, UnitId toUnit)
+{
+    if (!fromUnit.isValid() || !fromUnit.d->m_category) {
+        return qQNaN();
+    }
+    const Unit *to = ConverterPrivate::instance()->unit(toUnit);
+    if (!to || to->d->m_category != fromUnit.d->m_category) {
+        return qQNaN();
+    }
+    return fromUnit.d->m_category->convert(fromUnit, *to, number);
+}
+
+Value UnitCategoryPrivate::convertValue(const Unit &fromUnit, qreal number, const QString &toUnit)
 {
-    qreal v = value.unit().toDefault(value.number());
-    return Value(toUnit.fromDefault(v), toUnit);
+    if (!fromUnit.isValid() || !fromUnit.d->m_category) {
+        return Value();
+    }
+    const UnitCategoryPrivate *category = fromUnit.d->m_category;
+    if (toUnit.isEmpty()) {
+        return convertValue(fromUnit, number, category->m_defaultUnit);
+    }
+    const auto it = category->m_unitMap.constFind(toUnit);
+    if (it == category->m_unitMap.constEnd()) {
+        return Value();
+    }
+    return convertValue(fromUnit, number, it.value());
 }
 
 UnitCategory::UnitCategory()
@@ -145,6 +292,22 @@ QList<Unit> UnitCategory::mostCommonUnits() const
     return QList<Unit>();
 }
 
+QSpan<const Unit> UnitCategory::unitsView() const
+{
+    if (d) {
+        return d->m_units;
+    }
+    return {};
+}
+
+QSpan<const Unit> UnitCategory::mostCommonUnitsView() const
+{
+    if (d) {
+        return d->m_mostCommonUnits;
+    }
+    return {};
+}
+
 QStringList UnitCategory::allUnits() const
 {
     if (d) {
@@ -181,11 +344,35 @@ Value UnitCategory::convert(const Value &value, UnitId toUnit) const
 Value UnitCategory::convert(const Value &value, const Unit &toUnit) const
 {
     if (d && !toUnit.isNull()) {
-        return d->convert(value, toUnit);
+        return Value(d->convert(value.unit(), toUnit, value.number()), toUnit);
     }
     return Value();
 }
 
+bool UnitCategory::convertToAll(const Value &value, QSpan<qreal> output) const
+{
+    if (d && output.size() >= d->m_units.size()) {
+        const Unit unit = value.unit();
+        if (unit.isValid() && unit.d->m_category == d.data()) {
+            d->convertToAll(unit, value.number(), d->m_units, output);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool UnitCategory::convertToMostCommon(const Value &value, QSpan<qreal> output) const
+{
+    if (d && output.size() >= d->m_mostCommonUnits.size()) {
+        const Unit unit = value.unit();
+        if (unit.isValid() && unit.d->m_category == d.data()) {
+            d->convertToAll(unit, value.number(), d->m_mostCommonUnits, output);
+            return true;
+        }
+    }
+    return false;
+}
+
 Unit UnitCategory::unit(const QString &s) const
 {
     if (d) {
@@ -194,6 +381,19 @@ Unit UnitCategory::unit(const QString &s) const
     return Unit();
 }
 
+Unit UnitCategory::unit(const QString &s, UnitMatchMode mode) const
+{
+    if (d) {
+        if (const auto it = d->m_unitMap.constFind(s); it != d->m_unitMap.constEnd()) {
+            return it.value();
+        }
+        if (mode == NormalizedMatch) {
+            return d->m_normalizedUnitMap.value(UnitCategoryPrivate::normalizedName(s));
+        }
+    }
+    return Unit();
+}
+
 Unit UnitCategory::unit(UnitId unitId) const
 {
     if (d && d->m_idMap.contains(unitId)) {
@@ -226,6 +426,20 @@ QString UnitCategory::description() const
     return QString();
 }
 
+QString UnitCategoryPrivate::normalizedName(QStringView name)
+{
+    // decomposed, diacritics are combining marks following their base character
+    const QString decomposed = name.toString().normalized(QString::NormalizationForm_D);
+    QString normalized;
+    normalized.reserve(decomposed.size());
+    for (const QChar c : decomposed) {
+        if (c.category() != QChar::Mark_NonSpacing) {
+            normalized.append(c);
+        }
+    }
+    return normalized.toCaseFolded();
+}
+
 void UnitCategoryPrivate::addDefaultUnit(const Unit &unit)
 {
     addCommonUnit(unit);
@@ -251,11 +465,150 @@ void UnitCategoryPrivate::addUnit(const Unit &unit)
 
     for (const QString &name : list) {
         m_unitMap[name] = unit;
+        const QString key = normalizedName(name);
+        if (!m_normalizedUnitMap.contains(key)) {
+            m_normalizedUnitMap.insert(key, unit);
+        }
     }
     m_idMap[unit.id()] = unit;
+    unit.d->m_categoryIndex = m_units.size();
     m_units.append(unit);
 }
 
+qsizetype UnitCategoryPrivate::UnitLadder::stepFor(qreal defaultNumber) const
+{
+    const auto it = std::upper_bound(scales.cbegin(), scales.cend(), std::abs(defaultNumber));
+    return it == scales.cbegin() ? 0 : it - scales.cbegin() - 1;
+}
+
+void UnitCategoryPrivate::addUnitLadder(std::initializer_list<UnitId> steps, std::initializer_list<UnitId> members)
+{
+    UnitLadder ladder;
+    ladder.scales.reserve(steps.size());
+    ladder.steps.reserve(steps.size());
+    for (const UnitId unitId : steps) {
+        const Unit unit = m_idMap.value(unitId);
+        Q_ASSERT(unit.isValid());
+        const UnitTransform transform = unit.d->transform();
+        Q_ASSERT(transform.kind == UnitTransform::Linear && transform.offset == 0.0);
+        Q_ASSERT(ladder.scales.isEmpty() || ladder.scales.last() < transform.scale);
+        ladder.scales.append(transform.scale);
+        ladder.steps.append(unit);
+    }
+    m_unitLadders.append(ladder);
+
+    const qsizetype index = m_unitLadders.size() - 1;
+    for (const auto &unitIds : {steps, members}) {
+        for (const UnitId unitId : unitIds) {
+            if (!m_unitLadderIndex.contains(unitId)) {
+                m_unitLadderIndex.insert(unitId, index);
+            }
+        }
+    }
+}
+
+const UnitCategoryPrivate::UnitLadder *UnitCategoryPrivate::unitLadder(UnitId unitId) const
+{
+    const auto it = m_unitLadderIndex.constFind(unitId);
+    return it != m_unitLadderIndex.constEnd() ? &m_unitLadders[it.value()] : nullptr;
+}
+
+Unit UnitCategoryPrivate::bestUnit(const Unit &unit, qreal number)
+{
+    if (!unit.isValid() || !unit.d->m_category || number == 0.0 || !qIsFinite(number)) {
+        return unit;
+    }
+    const UnitLadder *ladder = unit.d->m_category->unitLadder(unit.id());
+    if (!ladder) {
+        return unit;
+    }
+    return ladder->steps[ladder->stepFor(number * unit.d->transform().scale)];
+}
+
+void UnitCategoryPrivate::toBestUnits(const Unit &unit, QSpan<const qreal> input, QSpan<qreal> output, QSpan<UnitId> units)
+{
+    const UnitLadder *ladder = unit.d->m_category ? unit.d->m_category->unitLadder(unit.id()) : nullptr;
+    if (!ladder) {
+        if (input.data() != output.data()) {
+            std::copy(input.begin(), input.end(), output.begin());
+        }
+        std::fill_n(units.begin(), input.size(), unit.id());
+        return;
+    }
+
+    // one kernel per step instead of one lookup per number
+    const qreal scale = unit.d->transform().scale;
+    QList<ConversionKernel> kernels;
+    kernels.reserve(ladder->steps.size());
+    for (const Unit &step : ladder->steps) {
+        kernels.append(kernelFor(unit, step));
+    }
+    for (qsizetype i = 0; i < input.size(); ++i) {
+        const qreal number = input[i];
+        if (number == 0.0 || !qIsFinite(number)) {
+            output[i] = number;
+            units[i] = unit.id();
+            continue;
+        }
+        const qsizetype step = ladder->stepFor(number * scale);
+        output[i] = kernels[step].apply(number);
+        units[i] = ladder->steps[step].id();
+    }
+}
+
+void UnitCategoryPrivate::convertMixed(QSpan<const qreal> input, QSpan<const UnitId> fromUnits, const Unit &toUnit, QSpan<qreal> output)
+{
+    UnitCategoryPrivate *category = toUnit.d->m_category;
+    if (!category || category->m_units.isEmpty()) {
+        std::fill_n(output.begin(), input.size(), qQNaN());
+        return;
+    }
+    category->convertFromUnits(input, fromUnits, toUnit, output);
+}
+
+void UnitCategoryPrivate::convertFromUnits(QSpan<const qreal> input, QSpan<const UnitId> fromUnits, const Unit &toUnit, QSpan<qreal> output)
+{
+    const MixedTable *table = mixedTable(toUnit);
+    const qsizetype tableSize = table->factors.size();
+    for (qsizetype i = 0; i < input.size(); ++i) {
+        // ids before the first one wrap around and fail the bounds check as well
+        const size_t index = size_t(fromUnits[i] - table->firstId);
+        if (index >= size_t(tableSize)) {
+            output[i] = qQNaN();
+            continue;
+        }
+        const qreal factor = table->factors[index];
+        output[i] = qIsNaN(factor) ? table->kernels[index].apply(input[i]) : factor * input[i];
+    }
+}
+
+const MixedTable *UnitCategoryPrivate::mixedTable(const Unit &toUnit)
+{
+    const MixedTable *table = toUnit.d->m_mixedTable.table();
+    if (table) {
+        return table;
+    }
+
+    // tables by id, the ids of the units of a category are close to each other
+    const auto [first, last] = std::minmax_element(m_units.cbegin(), m_units.cend(), [](const Unit &lhs, const Unit &rhs) {
+        return lhs.id() < rhs.id();
+    });
+    auto built = std::make_unique<MixedTable>();
+    built->firstId = first->id();
+    const qsizetype tableSize = last->id() - built->firstId + 1;
+    built->factors.resize(tableSize, qQNaN());
+    built->kernels.resize(tableSize);
+    for (const Unit &unit : std::as_const(m_units)) {
+        const ConversionKernel kernel = conversionKernel(unit, toUnit);
+        if (kernel.m_kind == ConversionKernel::Scale) {
+            built->factors[unit.id() - built->firstId] = kernel.m_a;
+        } else {
+            built->kernels[unit.id() - built->firstId] = kernel;
+        }
+    }
+    return toUnit.d->m_mixedTable.publish(std::move(built));
+}
+
 bool UnitCategory::hasOnlineConversionTable() const
 {
     return d->hasOnlineConversionTable();
@@ -14,6 +14,7 @@
 
 #include <QExplicitlySharedDataPointer>
 #include <QObject>
+#include <QSpan>
 #include <QString>
 #include <QStringList>
 
@@ -26,6 +27,24 @@ namespace KUnitConversion
 class UnitCategoryPrivate;
 class UpdateJob;
 
+/*!
+ * \enum KUnitConversion::UnitMatchMode
+ *
+ * How unit names are matched when looking up units by name.
+ *
+ * \value ExactMatch The name has to be one of the symbols or synonyms of the unit.
+ * \value NormalizedMatch Case and diacritics are ignored, so "KM" finds "km" and
+ *        "ångstroms" finds "Ångströms". An exact match is preferred. If several
+ *        names only differ in case or diacritics, the unit added first to its
+ *        category wins.
+ *
+ * \since 6.28
+ */
+enum UnitMatchMode {
+    ExactMatch,
+    NormalizedMatch,
+};
+
 /*!
  * \class KUnitConversion::UnitCategory
  * \inmodule KUnitConversion
@@ -94,6 +113,13 @@ public:
      **/
     Unit unit(const QString &s) const;
 
+    /*!
+     * Returns unit for string \a s, matched according to \a mode.
+     *
+     * \since 6.28
+     **/
+    Unit unit(const QString &s, UnitMatchMode mode) const;
+
     /*!
      * Returns unit for unit enum.
      **/
@@ -109,6 +135,24 @@ public:
      **/
     QList<Unit> mostCommonUnits() const;
 
+    /*!
+     * Returns the units in this category without copying them, valid as long
+     * as the category exists.
+     *
+     * \sa units()
+     * \since 6.28
+     **/
+    QSpan<const Unit> unitsView() const;
+
+    /*!
+     * Returns the most common units in this category without copying them,
+     * valid as long as the category exists.
+     *
+     * \sa mostCommonUnits()
+     * \since 6.28
+     **/
+    QSpan<const Unit> mostCommonUnitsView() const;
+
     /*!
      * Returns all unit names, short names and unit synonyms in this category.
      **/
@@ -151,6 +195,31 @@ public:
      **/
     Value convert(const Value &value, const Unit &toUnit) const;
 
+    /*!
+     * Converts \a value to every unit of this category at once.
+     *
+     * The number of \a value is converted to the default unit once and from
+     * there to all units, which is much faster than calling convert() for each
+     * unit. The numbers are written to \a output in the order of unitsView().
+     *
+     * Returns false without touching \a output if \a value is not in a unit of
+     * this category or \a output is smaller than unitsView().
+     *
+     * \sa convertToMostCommon(), unitsView()
+     * \since 6.28
+     **/
+    bool convertToAll(const Value &value, QSpan<qreal> output) const;
+
+    /*!
+     * Converts \a value to every one of the most common units of this category
+     * at once, like convertToAll(). The numbers are written to \a output in the
+     * order of mostCommonUnitsView().
+     *
+     * \sa convertToAll(), mostCommonUnitsView()
+     * \since 6.28
+     **/
+    bool convertToMostCommon(const Value &value, QSpan<qreal> output) const;
+
     /*!
      * Returns true if category has conversion table that needs to be updated via online access, otherwise false
      * \sa syncConversionTable()
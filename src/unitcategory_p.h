@@ -8,16 +8,88 @@
 #ifndef KUNITCONVERSION_UNITCATEGORY_P_H
 #define KUNITCONVERSION_UNITCATEGORY_P_H
 
+#include "conversionplan_p.h"
 #include "unitcategory.h"
 
 #include <KLocalizedString>
 
+#include <QAtomicPointer>
+#include <QHash>
 #include <QMap>
+#include <QSpan>
+
+#include <initializer_list>
+#include <memory>
+#include <optional>
 
 class QNetworkAccessManager;
 
 namespace KUnitConversion
 {
+/**
+ * Factors between all pairs of units of a category in which every unit is
+ * a pure scale of the default unit, by the position of the units in the category.
+ * ConversionPlan and the batch conversions use them, Value::convertTo() still
+ * converts through the default unit to keep its results.
+ */
+struct FactorMatrix {
+    qreal factor(qsizetype fromIndex, qsizetype toIndex) const
+    {
+        return factors[fromIndex * size + toIndex];
+    }
+
+    qsizetype size = 0; //!< 0 if some unit is not a pure scale
+    QList<qreal> factors;
+};
+
+/**
+ * Conversions from every unit of a category to one unit, by unit id
+ * relative to the smallest id of the category.
+ */
+struct MixedTable {
+    int firstId = 0;
+    QList<qreal> factors; //!< NaN for ids taking the slow path through their kernel
+    QList<ConversionKernel> kernels; //!< invalid for ids without a unit
+};
+
+/**
+ * A table of a category or unit once it is built. The first table
+ * published wins and lives as long as the cache.
+ */
+template<typename T>
+class PublishedTable
+{
+public:
+    PublishedTable() = default;
+    // a copy builds its table again
+    PublishedTable(const PublishedTable &)
+    {
+    }
+    PublishedTable &operator=(const PublishedTable &) = delete;
+    ~PublishedTable()
+    {
+        delete m_table.loadRelaxed();
+    }
+
+    /** The published table, nullptr if there is none yet. */
+    const T *table() const
+    {
+        return m_table.loadAcquire();
+    }
+
+    /** Publishes @p table unless another thread was faster, returns the published one. */
+    const T *publish(std::unique_ptr<const T> table)
+    {
+        if (m_table.testAndSetOrdered(nullptr, table.get())) {
+            return table.release();
+        }
+        return m_table.loadAcquire();
+    }
+
+private:
+    QAtomicPointer<const T> m_table;
+};
+
 class UnitCategoryPrivate : public QSharedData
 {
 public:
@@ -29,7 +101,16 @@ public:
     bool operator==(const UnitCategoryPrivate &other) const;
     bool operator!=(const UnitCategoryPrivate &other) const;
 
-    virtual Value convert(const Value &value, const Unit &toUnit);
+    virtual qreal convert(const Unit &fromUnit, const Unit &toUnit, qreal value);
+    void convert(const Unit &fromUnit, const Unit &toUnit, QSpan<const qreal> input, QSpan<qreal> output);
+    void convert(const Unit &fromUnit, const Unit &toUnit, QSpan<const float> input, QSpan<float> output);
+    virtual ConversionKernel conversionKernel(const Unit &fromUnit, const Unit &toUnit);
+
+    /**
+     * Converts @p number in @p fromUnit to each of @p units into @p output,
+     * all units are of this category and @p output is at least as large as @p units.
+     */
+    virtual void convertToAll(const Unit &fromUnit, qreal number, QSpan<const Unit> units, QSpan<qreal> output);
 
     virtual bool hasOnlineConversionTable() const
     {
@@ -46,6 +127,81 @@ public:
     void addCommonUnit(const Unit &unit);
     void addUnit(const Unit &unit);
 
+    /**
+     * Units of one system ordered by size, e.g. the SI prefixes of a unit,
+     * between which bestUnit() picks.
+     */
+    struct UnitLadder {
+        /** Step for a number of @p defaultNumber in the default unit. */
+        qsizetype stepFor(qreal defaultNumber) const;
+
+        QList<qreal> scales; //!< size of each step in the default unit, ascending
+        QList<Unit> steps;
+    };
+
+    /**
+     * Adds a ladder of the already added units @p steps, sorted by size, all
+     * with a linear conversion. Values in one of @p members are scaled to the
+     * ladder as well, but the members are never picked themselves.
+     * A unit belongs to the first ladder it is part of.
+     */
+    void addUnitLadder(std::initializer_list<UnitId> steps, std::initializer_list<UnitId> members = {});
+
+    /** Ladder @p unitId belongs to, nullptr if there is none. */
+    const UnitLadder *unitLadder(UnitId unitId) const;
+
+    /**
+     * Largest step of the ladder of @p unit in which @p number is at least 1, or
+     * the smallest step. @p unit itself if it has no ladder or for zero, NaN and infinity.
+     */
+    static Unit bestUnit(const Unit &unit, qreal number);
+
+    /** Converts @p input in @p unit to the bestUnit() of each number, see Converter::toBestUnits(). */
+    static void toBestUnits(const Unit &unit, QSpan<const qreal> input, QSpan<qreal> output, QSpan<UnitId> units);
+
+    /**
+     * Converts each number of @p input in the unit at the same position in @p fromUnits
+     * to @p toUnit, see Converter::convert(). Numbers in units of other categories become NaN.
+     */
+    static void convertMixed(QSpan<const qreal> input, QSpan<const UnitId> fromUnits, const Unit &toUnit, QSpan<qreal> output);
+
+    /** convertMixed() for a @p toUnit of this category. */
+    virtual void convertFromUnits(QSpan<const qreal> input, QSpan<const UnitId> fromUnits, const Unit &toUnit, QSpan<qreal> output);
+
+    /** Conversions from all units of this category to @p toUnit, built on first use. */
+    const MixedTable *mixedTable(const Unit &toUnit);
+
+    /** @p name case folded and without diacritics, the key of m_normalizedUnitMap. */
+    static QString normalizedName(QStringView name);
+
+    /** Kernel converting from @p fromUnit to @p toUnit, invalid unless both belong to the same category. */
+    static ConversionKernel kernelFor(const Unit &fromUnit, const Unit &toUnit);
+
+    /**
+     * The factor matrix of the category, built on first use, nullptr unless
+     * every unit is a pure scale of the default unit.
+     */
+    const FactorMatrix *factorMatrix();
+
+    /** Factor from @p fromUnit to @p toUnit if both are units of this category with a factor matrix. */
+    std::optional<qreal> factor(const Unit &fromUnit, const Unit &toUnit);
+
+    /**
+     * Converts @p number in @p fromUnit to @p toUnit with the category of @p fromUnit,
+     * an invalid value if @p fromUnit is invalid. The other overloads also fail for
+     * units of other categories, an empty @p toUnit name means the default unit.
+     *
+     * Only the handle held by the returned value is copied, no reference to the
+     * converter, the units or the category is taken on the way, so that converting
+     * from many threads does not contend on their reference counts.
+     */
+    static Value convertValue(const Unit &fromUnit, qreal number, const Unit &toUnit);
+    static Value convertValue(const Unit &fromUnit, qreal number, UnitId toUnit);
+    static Value convertValue(const Unit &fromUnit, qreal number, const QString &toUnit);
+
+    /** Number of convertValue(), NaN if the conversion fails, without creating a Value. */
+    static qreal convertNumber(const Unit &fromUnit, qreal number, UnitId toUnit);
+
     static inline UnitCategoryPrivate* get(const UnitCategory &category)
     {
         return category.d.data();
@@ -76,9 +232,13 @@ public:
     KLocalizedString m_symbolStringFormat;
     Unit m_defaultUnit;
     QMap<QString, Unit> m_unitMap;
+    QHash<QString, Unit> m_normalizedUnitMap; //!< by normalizedName(), the unit added first wins
     QMap<UnitId, Unit> m_idMap;
     QList<Unit> m_units;
     QList<Unit> m_mostCommonUnits;
+    QList<UnitLadder> m_unitLadders;
+    QMap<UnitId, qsizetype> m_unitLadderIndex; //!< index in m_unitLadders of the units in a ladder
+    PublishedTable<FactorMatrix> m_factorMatrix;
 };
 
 } // KUnitConversion namespace
@@ -0,0 +1,651 @@
+/*
+ *   SPDX-FileCopyrightText: 2026 KUnitConversion Authors
+ *
+ *   SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#ifndef KUNITCONVERSION_UNITTABLE_H
+#define KUNITCONVERSION_UNITTABLE_H
+
+#include "unit.h"
+
+#include <cstddef>
+#include <iterator>
+
+namespace KUnitConversion
+{
+/*!
+ * \class KUnitConversion::UnitDefinition
+ * \inmodule KUnitConversion
+ * \inheaderfile KUnitConversion/UnitTable
+ *
+ * \brief Compile-time description of how a unit converts to the default unit of its category.
+ *
+ * The units returned by Converter are built from the definitions in
+ * unitDefinitions, so conversions done at compile time with convert() give
+ * the same results as ConversionPlan. Currencies are not listed, their rates
+ * are only known at runtime.
+ *
+ * \sa unitDefinition(), convert()
+ * \since 6.28
+ */
+struct UnitDefinition {
+    /*!
+     * \value Linear the number in the default unit is scale * number + offset
+     * \value Reciprocal the number in the default unit is scale / number
+     * \value Other a formula only available at runtime, such as a logarithmic scale,
+     *        with scale as its parameter
+     */
+    enum Kind {
+        Linear,
+        Reciprocal,
+        Other,
+    };
+
+    UnitId id;
+    CategoryId categoryId;
+    Kind kind;
+    qreal scale;
+    qreal offset = 0.0;
+};
+
+/*!
+ * \variable KUnitConversion::unitDefinitions
+ * \inheaderfile KUnitConversion/UnitTable
+ *
+ * The definitions of all units but currencies, sorted by UnitId.
+ *
+ * \since 6.28
+ */
+inline constexpr UnitDefinition unitDefinitions[] = {
+    // Area
+    {SquareYottameter, AreaCategory, UnitDefinition::Linear, 1e+48},
+    {SquareZettameter, AreaCategory, UnitDefinition::Linear, 1e+42},
+    {SquareExameter, AreaCategory, UnitDefinition::Linear, 1e+36},
+    {SquarePetameter, AreaCategory, UnitDefinition::Linear, 1e+30},
+    {SquareTerameter, AreaCategory, UnitDefinition::Linear, 1e+24},
+    {SquareGigameter, AreaCategory, UnitDefinition::Linear, 1e+18},
+    {SquareMegameter, AreaCategory, UnitDefinition::Linear, 1e+12},
+    {SquareKilometer, AreaCategory, UnitDefinition::Linear, 1e+06},
+    {SquareHectometer, AreaCategory, UnitDefinition::Linear, 10000},
+    {SquareDecameter, AreaCategory, UnitDefinition::Linear, 100},
+    {SquareMeter, AreaCategory, UnitDefinition::Linear, 1},
+    {SquareDecimeter, AreaCategory, UnitDefinition::Linear, 0.01},
+    {SquareCentimeter, AreaCategory, UnitDefinition::Linear, 0.0001},
+    {SquareMillimeter, AreaCategory, UnitDefinition::Linear, 1e-06},
+    {SquareMicrometer, AreaCategory, UnitDefinition::Linear, 1e-12},
+    {SquareNanometer, AreaCategory, UnitDefinition::Linear, 1e-18},
+    {SquarePicometer, AreaCategory, UnitDefinition::Linear, 1e-24},
+    {SquareFemtometer, AreaCategory, UnitDefinition::Linear, 1e-30},
+    {SquareAttometer, AreaCategory, UnitDefinition::Linear, 1e-36},
+    {SquareZeptometer, AreaCategory, UnitDefinition::Linear, 1e-42},
+    {SquareYoctometer, AreaCategory, UnitDefinition::Linear, 1e-48},
+    {Acre, AreaCategory, UnitDefinition::Linear, 4046.86},
+    {SquareFoot, AreaCategory, UnitDefinition::Linear, 0.092903},
+    {SquareInch, AreaCategory, UnitDefinition::Linear, 0.00064516},
+    {SquareMile, AreaCategory, UnitDefinition::Linear, 2.58999e+06},
+
+    // Length
+    {Yottameter, LengthCategory, UnitDefinition::Linear, 1e+24},
+    {Zettameter, LengthCategory, UnitDefinition::Linear, 1e+21},
+    {Exameter, LengthCategory, UnitDefinition::Linear, 1e+18},
+    {Petameter, LengthCategory, UnitDefinition::Linear, 1e+15},
+    {Terameter, LengthCategory, UnitDefinition::Linear, 1e+12},
+    {Gigameter, LengthCategory, UnitDefinition::Linear, 1e+09},
+    {Megameter, LengthCategory, UnitDefinition::Linear, 1e+06},
+    {Kilometer, LengthCategory, UnitDefinition::Linear, 1000},
+    {Hectometer, LengthCategory, UnitDefinition::Linear, 100},
+    {Decameter, LengthCategory, UnitDefinition::Linear, 10},
+    {Meter, LengthCategory, UnitDefinition::Linear, 1},
+    {Decimeter, LengthCategory, UnitDefinition::Linear, 0.1},
+    {Centimeter, LengthCategory, UnitDefinition::Linear, 0.01},
+    {Millimeter, LengthCategory, UnitDefinition::Linear, 0.001},
+    {Micrometer, LengthCategory, UnitDefinition::Linear, 1e-06},
+    {Nanometer, LengthCategory, UnitDefinition::Linear, 1e-09},
+    {Picometer, LengthCategory, UnitDefinition::Linear, 1e-12},
+    {Femtometer, LengthCategory, UnitDefinition::Linear, 1e-15},
+    {Attometer, LengthCategory, UnitDefinition::Linear, 1e-18},
+    {Zeptometer, LengthCategory, UnitDefinition::Linear, 1e-21},
+    {Yoctometer, LengthCategory, UnitDefinition::Linear, 1e-24},
+    {Inch, LengthCategory, UnitDefinition::Linear, 0.0254},
+    {Foot, LengthCategory, UnitDefinition::Linear, 0.3048},
+    {Yard, LengthCategory, UnitDefinition::Linear, 0.9144},
+    {Mile, LengthCategory, UnitDefinition::Linear, 1609.34},
+    {NauticalMile, LengthCategory, UnitDefinition::Linear, 1852},
+    {LightYear, LengthCategory, UnitDefinition::Linear, 9.46073e+15},
+    {Parsec, LengthCategory, UnitDefinition::Linear, 3.08568e+16},
+    {AstronomicalUnit, LengthCategory, UnitDefinition::Linear, 1.49598e+11},
+    {Thou, LengthCategory, UnitDefinition::Linear, 0.0000254},
+    {Angstrom, LengthCategory, UnitDefinition::Linear, 1e-10},
+    {RackUnit, LengthCategory, UnitDefinition::Linear, 0.04445},
+    {Link, LengthCategory, UnitDefinition::Linear, 0.201168},
+    {Chain, LengthCategory, UnitDefinition::Linear, 20.1168},
+    {Furlong, LengthCategory, UnitDefinition::Linear, 201.168},
+    {Fathom, LengthCategory, UnitDefinition::Linear, 1.8288},
+    {RodPerchPole, LengthCategory, UnitDefinition::Linear, 5.0292},
+
+    // Volume
+    {CubicYottameter, VolumeCategory, UnitDefinition::Linear, 1e+72},
+    {CubicZettameter, VolumeCategory, UnitDefinition::Linear, 1e+63},
+    {CubicExameter, VolumeCategory, UnitDefinition::Linear, 1e+54},
+    {CubicPetameter, VolumeCategory, UnitDefinition::Linear, 1e+45},
+    {CubicTerameter, VolumeCategory, UnitDefinition::Linear, 1e+36},
+    {CubicGigameter, VolumeCategory, UnitDefinition::Linear, 1e+27},
+    {CubicMegameter, VolumeCategory, UnitDefinition::Linear, 1e+18},
+    {CubicKilometer, VolumeCategory, UnitDefinition::Linear, 1e+09},
+    {CubicHectometer, VolumeCategory, UnitDefinition::Linear, 1e+06},
+    {CubicDecameter, VolumeCategory, UnitDefinition::Linear, 1000},
+    {CubicMeter, VolumeCategory, UnitDefinition::Linear, 1},
+    {CubicDecimeter, VolumeCategory, UnitDefinition::Linear, 0.001},
+    {CubicCentimeter, VolumeCategory, UnitDefinition::Linear, 1e-06},
+    {CubicMillimeter, VolumeCategory, UnitDefinition::Linear, 1e-09},
+    {CubicMicrometer, VolumeCategory, UnitDefinition::Linear, 1e-18},
+    {CubicNanometer, VolumeCategory, UnitDefinition::Linear, 1e-27},
+    {CubicPicometer, VolumeCategory, UnitDefinition::Linear, 1e-36},
+    {CubicFemtometer, VolumeCategory, UnitDefinition::Linear, 1e-45},
+    {CubicAttometer, VolumeCategory, UnitDefinition::Linear, 1e-54},
+    {CubicZeptometer, VolumeCategory, UnitDefinition::Linear, 1e-63},
+    {CubicYoctometer, VolumeCategory, UnitDefinition::Linear, 1e-72},
+    {Yottaliter, VolumeCategory, UnitDefinition::Linear, 1e+21},
+    {Zettaliter, VolumeCategory, UnitDefinition::Linear, 1e+18},
+    {Exaliter, VolumeCategory, UnitDefinition::Linear, 1e+15},
+    {Petaliter, VolumeCategory, UnitDefinition::Linear, 1e+12},
+    {Teraliter, VolumeCategory, UnitDefinition::Linear, 1e+09},
+    {Gigaliter, VolumeCategory, UnitDefinition::Linear, 1e+06},
+    {Megaliter, VolumeCategory, UnitDefinition::Linear, 1000},
+    {Kiloliter, VolumeCategory, UnitDefinition::Linear, 1},
+    {Hectoliter, VolumeCategory, UnitDefinition::Linear, 0.1},
+    {Decaliter, VolumeCategory, UnitDefinition::Linear, 0.01},
+    {Liter, VolumeCategory, UnitDefinition::Linear, 0.001},
+    {Deciliter, VolumeCategory, UnitDefinition::Linear, 0.0001},
+    {Centiliter, VolumeCategory, UnitDefinition::Linear, 1e-05},
+    {Milliliter, VolumeCategory, UnitDefinition::Linear, 1e-06},
+    {Microliter, VolumeCategory, UnitDefinition::Linear, 1e-09},
+    {Nanoliter, VolumeCategory, UnitDefinition::Linear, 1e-12},
+    {Picoliter, VolumeCategory, UnitDefinition::Linear, 1e-15},
+    {Femtoliter, VolumeCategory, UnitDefinition::Linear, 1e-18},
+    {Attoliter, VolumeCategory, UnitDefinition::Linear, 1e-21},
+    {Zeptoliter, VolumeCategory, UnitDefinition::Linear, 1e-24},
+    {Yoctoliter, VolumeCategory, UnitDefinition::Linear, 1e-27},
+    {CubicFoot, VolumeCategory, UnitDefinition::Linear, 0.0283168},
+    {CubicInch, VolumeCategory, UnitDefinition::Linear, 1.63871e-05},
+    {CubicMile, VolumeCategory, UnitDefinition::Linear, 4.16818e+09},
+    {FluidOunce, VolumeCategory, UnitDefinition::Linear, 2.95735e-05},
+    {Cup, VolumeCategory, UnitDefinition::Linear, 0.000236588},
+    {Teaspoon, VolumeCategory, UnitDefinition::Linear, 0.000005},
+    {Tablespoon, VolumeCategory, UnitDefinition::Linear, 0.000015},
+    {GallonUS, VolumeCategory, UnitDefinition::Linear, 0.00378541},
+    {PintImperial, VolumeCategory, UnitDefinition::Linear, 0.000568261},
+    {OilBarrel, VolumeCategory, UnitDefinition::Linear, 0.158987294},
+    {GallonImperial, VolumeCategory, UnitDefinition::Linear, 0.00454609},
+    {PintUS, VolumeCategory, UnitDefinition::Linear, 0.000473176},
+
+    // Mass
+    {Yottagram, MassCategory, UnitDefinition::Linear, 1e+24},
+    {Zettagram, MassCategory, UnitDefinition::Linear, 1e+21},
+    {Exagram, MassCategory, UnitDefinition::Linear, 1e+18},
+    {Petagram, MassCategory, UnitDefinition::Linear, 1e+15},
+    {Teragram, MassCategory, UnitDefinition::Linear, 1e+12},
+    {Gigagram, MassCategory, UnitDefinition::Linear, 1e+09},
+    {Megagram, MassCategory, UnitDefinition::Linear, 1e+06},
+    {Kilogram, MassCategory, UnitDefinition::Linear, 1000},
+    {Hectogram, MassCategory, UnitDefinition::Linear, 100},
+    {Decagram, MassCategory, UnitDefinition::Linear, 10},
+    {Gram, MassCategory, UnitDefinition::Linear, 1},
+    {Decigram, MassCategory, UnitDefinition::Linear, 0.1},
+    {Centigram, MassCategory, UnitDefinition::Linear, 0.01},
+    {Milligram, MassCategory, UnitDefinition::Linear, 0.001},
+    {Microgram, MassCategory, UnitDefinition::Linear, 1e-06},
+    {Nanogram, MassCategory, UnitDefinition::Linear, 1e-09},
+    {Picogram, MassCategory, UnitDefinition::Linear, 1e-12},
+    {Femtogram, MassCategory, UnitDefinition::Linear, 1e-15},
+    {Attogram, MassCategory, UnitDefinition::Linear, 1e-18},
+    {Zeptogram, MassCategory, UnitDefinition::Linear, 1e-21},
+    {Yoctogram, MassCategory, UnitDefinition::Linear, 1e-24},
+    {Ton, MassCategory, UnitDefinition::Linear, 1e+06},
+    {Carat, MassCategory, UnitDefinition::Linear, 0.2},
+    {Pound, MassCategory, UnitDefinition::Linear, 453.592},
+    {Ounce, MassCategory, UnitDefinition::Linear, 28.3495},
+    {TroyOunce, MassCategory, UnitDefinition::Linear, 31.1035},
+    {MassNewton, MassCategory, UnitDefinition::Linear, 101.937},
+    {Kilonewton, MassCategory, UnitDefinition::Linear, 101937},
+    {Stone, MassCategory, UnitDefinition::Linear, 6350.29318},
+
+    // Pressure
+    {Yottapascal, PressureCategory, UnitDefinition::Linear, 1e+24},
+    {Zettapascal, PressureCategory, UnitDefinition::Linear, 1e+21},
+    {Exapascal, PressureCategory, UnitDefinition::Linear, 1e+18},
+    {Petapascal, PressureCategory, UnitDefinition::Linear, 1e+15},
+    {Terapascal, PressureCategory, UnitDefinition::Linear, 1e+12},
+    {Gigapascal, PressureCategory, UnitDefinition::Linear, 1e+09},
+    {Megapascal, PressureCategory, UnitDefinition::Linear, 1e+06},
+    {Kilopascal, PressureCategory, UnitDefinition::Linear, 1000},
+    {Hectopascal, PressureCategory, UnitDefinition::Linear, 100},
+    {Decapascal, PressureCategory, UnitDefinition::Linear, 10},
+    {Pascal, PressureCategory, UnitDefinition::Linear, 1},
+    {Decipascal, PressureCategory, UnitDefinition::Linear, 0.1},
+    {Centipascal, PressureCategory, UnitDefinition::Linear, 0.01},
+    {Millipascal, PressureCategory, UnitDefinition::Linear, 0.001},
+    {Micropascal, PressureCategory, UnitDefinition::Linear, 1e-06},
+    {Nanopascal, PressureCategory, UnitDefinition::Linear, 1e-09},
+    {Picopascal, PressureCategory, UnitDefinition::Linear, 1e-12},
+    {Femtopascal, PressureCategory, UnitDefinition::Linear, 1e-15},
+    {Attopascal, PressureCategory, UnitDefinition::Linear, 1e-18},
+    {Zeptopascal, PressureCategory, UnitDefinition::Linear, 1e-21},
+    {Yoctopascal, PressureCategory, UnitDefinition::Linear, 1e-24},
+    {Bar, PressureCategory, UnitDefinition::Linear, 100000},
+    {Millibar, PressureCategory, UnitDefinition::Linear, 100},
+    {Decibar, PressureCategory, UnitDefinition::Linear, 10000},
+    {Torr, PressureCategory, UnitDefinition::Linear, 133.322},
+    {TechnicalAtmosphere, PressureCategory, UnitDefinition::Linear, 98066.5},
+    {Atmosphere, PressureCategory, UnitDefinition::Linear, 101325},
+    {PoundForcePerSquareInch, PressureCategory, UnitDefinition::Linear, 6894.76},
+    {InchesOfMercury, PressureCategory, UnitDefinition::Linear, 3386.39},
+    {MillimetersOfMercury, PressureCategory, UnitDefinition::Linear, 133.322},
+
+    // Temperature
+    {Kelvin, TemperatureCategory, UnitDefinition::Linear, 1},
+    {Celsius, TemperatureCategory, UnitDefinition::Linear, 1.0, 273.15},
+    {Fahrenheit, TemperatureCategory, UnitDefinition::Linear, 5.0 / 9.0, 459.67 * 5.0 / 9.0},
+    {Rankine, TemperatureCategory, UnitDefinition::Linear, 0.555556},
+    {Delisle, TemperatureCategory, UnitDefinition::Linear, -2.0 / 3.0, 373.15},
+    {TemperatureNewton, TemperatureCategory, UnitDefinition::Linear, 100.0 / 33.0, 273.15},
+    {Reaumur, TemperatureCategory, UnitDefinition::Linear, 5.0 / 4.0, 273.15},
+    {Romer, TemperatureCategory, UnitDefinition::Linear, 40.0 / 21.0, 273.15 - 7.5 * 40.0 / 21.0},
+
+    // Energy
+    {Yottajoule, EnergyCategory, UnitDefinition::Linear, 1e+24},
+    {Zettajoule, EnergyCategory, UnitDefinition::Linear, 1e+21},
+    {Exajoule, EnergyCategory, UnitDefinition::Linear, 1e+18},
+    {Petajoule, EnergyCategory, UnitDefinition::Linear, 1e+15},
+    {Terajoule, EnergyCategory, UnitDefinition::Linear, 1e+12},
+    {Gigajoule, EnergyCategory, UnitDefinition::Linear, 1e+09},
+    {Megajoule, EnergyCategory, UnitDefinition::Linear, 1e+06},
+    {Kilojoule, EnergyCategory, UnitDefinition::Linear, 1000},
+    {Hectojoule, EnergyCategory, UnitDefinition::Linear, 100},
+    {Decajoule, EnergyCategory, UnitDefinition::Linear, 10},
+    {Joule, EnergyCategory, UnitDefinition::Linear, 1},
+    {Decijoule, EnergyCategory, UnitDefinition::Linear, 0.1},
+    {Centijoule, EnergyCategory, UnitDefinition::Linear, 0.01},
+    {Millijoule, EnergyCategory, UnitDefinition::Linear, 0.001},
+    {Microjoule, EnergyCategory, UnitDefinition::Linear, 1e-06},
+    {Nanojoule, EnergyCategory, UnitDefinition::Linear, 1e-09},
+    {Picojoule, EnergyCategory, UnitDefinition::Linear, 1e-12},
+    {Femtojoule, EnergyCategory, UnitDefinition::Linear, 1e-15},
+    {Attojoule, EnergyCategory, UnitDefinition::Linear, 1e-18},
+    {Zeptojoule, EnergyCategory, UnitDefinition::Linear, 1e-21},
+    {Yoctojoule, EnergyCategory, UnitDefinition::Linear, 1e-24},
+    {GuidelineDailyAmount, EnergyCategory, UnitDefinition::Linear, 8.3736e+06},
+    {Electronvolt, EnergyCategory, UnitDefinition::Linear, 1.60218e-19},
+    {Rydberg, EnergyCategory, UnitDefinition::Linear, 2.17987e-18},
+    {Kilocalorie, EnergyCategory, UnitDefinition::Linear, 4186.8},
+    {PhotonWavelength, EnergyCategory, UnitDefinition::Reciprocal, (2.99792458e+08 * 6.62606896e-34) / 1e-09},
+    {KiloJoulePerMole, EnergyCategory, UnitDefinition::Linear, 1.66054238581e-21},
+    {JoulePerMole, EnergyCategory, UnitDefinition::Linear, 1.66054238581e-24},
+    {Btu, EnergyCategory, UnitDefinition::Linear, 1055.05585},
+    {Erg, EnergyCategory, UnitDefinition::Linear, 1.0e-7},
+    {TeraWattHour, EnergyCategory, UnitDefinition::Linear, 1e+12 * 60 * 60},
+    {GigaWattHour, EnergyCategory, UnitDefinition::Linear, 1e+09 * 60 * 60},
+    {MegaWattHour, EnergyCategory, UnitDefinition::Linear, 1e+06 * 60 * 60},
+    {KiloWattHour, EnergyCategory, UnitDefinition::Linear, 1000 * 60 * 60},
+    {WattHour, EnergyCategory, UnitDefinition::Linear, 60 * 60},
+
+    // Velocity
+    {MeterPerSecond, VelocityCategory, UnitDefinition::Linear, 1},
+    {KilometerPerHour, VelocityCategory, UnitDefinition::Linear, 0.277778},
+    {MilePerHour, VelocityCategory, UnitDefinition::Linear, 0.44704},
+    {FootPerSecond, VelocityCategory, UnitDefinition::Linear, 0.3048},
+    {InchPerSecond, VelocityCategory, UnitDefinition::Linear, 0.0254},
+    {Knot, VelocityCategory, UnitDefinition::Linear, 0.514444},
+    {Mach, VelocityCategory, UnitDefinition::Linear, 343},
+    {SpeedOfLight, VelocityCategory, UnitDefinition::Linear, 2.99792458e+08},
+    {Beaufort, VelocityCategory, UnitDefinition::Other, 1.0},
+
+    // Power
+    {Yottawatt, PowerCategory, UnitDefinition::Linear, 1e+24},
+    {Zettawatt, PowerCategory, UnitDefinition::Linear, 1e+21},
+    {Exawatt, PowerCategory, UnitDefinition::Linear, 1e+18},
+    {Petawatt, PowerCategory, UnitDefinition::Linear, 1e+15},
+    {Terawatt, PowerCategory, UnitDefinition::Linear, 1e+12},
+    {Gigawatt, PowerCategory, UnitDefinition::Linear, 1e+09},
+    {Megawatt, PowerCategory, UnitDefinition::Linear, 1e+06},
+    {Kilowatt, PowerCategory, UnitDefinition::Linear, 1000},
+    {Hectowatt, PowerCategory, UnitDefinition::Linear, 100},
+    {Decawatt, PowerCategory, UnitDefinition::Linear, 10},
+    {Watt, PowerCategory, UnitDefinition::Linear, 1},
+    {Deciwatt, PowerCategory, UnitDefinition::Linear, 0.1},
+    {Centiwatt, PowerCategory, UnitDefinition::Linear, 0.01},
+    {Milliwatt, PowerCategory, UnitDefinition::Linear, 0.001},
+    {Microwatt, PowerCategory, UnitDefinition::Linear, 1e-06},
+    {Nanowatt, PowerCategory, UnitDefinition::Linear, 1e-09},
+    {Picowatt, PowerCategory, UnitDefinition::Linear, 1e-12},
+    {Femtowatt, PowerCategory, UnitDefinition::Linear, 1e-15},
+    {Attowatt, PowerCategory, UnitDefinition::Linear, 1e-18},
+    {Zeptowatt, PowerCategory, UnitDefinition::Linear, 1e-21},
+    {Yoctowatt, PowerCategory, UnitDefinition::Linear, 1e-24},
+    {Horsepower, PowerCategory, UnitDefinition::Linear, 735.499},
+    {DecibelKilowatt, PowerCategory, UnitDefinition::Other, 1000},
+    {DecibelWatt, PowerCategory, UnitDefinition::Other, 1},
+    {DecibelMilliwatt, PowerCategory, UnitDefinition::Other, 0.001},
+    {DecibelMicrowatt, PowerCategory, UnitDefinition::Other, 1e-6},
+
+    // Time
+    {Yottasecond, TimeCategory, UnitDefinition::Linear, 1e+24},
+    {Zettasecond, TimeCategory, UnitDefinition::Linear, 1e+21},
+    {Exasecond, TimeCategory, UnitDefinition::Linear, 1e+18},
+    {Petasecond, TimeCategory, UnitDefinition::Linear, 1e+15},
+    {Terasecond, TimeCategory, UnitDefinition::Linear, 1e+12},
+    {Gigasecond, TimeCategory, UnitDefinition::Linear, 1e+09},
+    {Megasecond, TimeCategory, UnitDefinition::Linear, 1e+06},
+    {Kilosecond, TimeCategory, UnitDefinition::Linear, 1000},
+    {Hectosecond, TimeCategory, UnitDefinition::Linear, 100},
+    {Decasecond, TimeCategory, UnitDefinition::Linear, 10},
+    {Second, TimeCategory, UnitDefinition::Linear, 1},
+    {Decisecond, TimeCategory, UnitDefinition::Linear, 0.1},
+    {Centisecond, TimeCategory, UnitDefinition::Linear, 0.01},
+    {Millisecond, TimeCategory, UnitDefinition::Linear, 0.001},
+    {Microsecond, TimeCategory, UnitDefinition::Linear, 1e-06},
+    {Nanosecond, TimeCategory, UnitDefinition::Linear, 1e-09},
+    {Picosecond, TimeCategory, UnitDefinition::Linear, 1e-12},
+    {Femtosecond, TimeCategory, UnitDefinition::Linear, 1e-15},
+    {Attosecond, TimeCategory, UnitDefinition::Linear, 1e-18},
+    {Zeptosecond, TimeCategory, UnitDefinition::Linear, 1e-21},
+    {Yoctosecond, TimeCategory, UnitDefinition::Linear, 1e-24},
+    {Minute, TimeCategory, UnitDefinition::Linear, 60},
+    {Hour, TimeCategory, UnitDefinition::Linear, 3600},
+    {Day, TimeCategory, UnitDefinition::Linear, 86400},
+    {Week, TimeCategory, UnitDefinition::Linear, 604800},
+    {JulianYear, TimeCategory, UnitDefinition::Linear, 3.15576e+07},
+    {LeapYear, TimeCategory, UnitDefinition::Linear, 3.16224e+07},
+    {Year, TimeCategory, UnitDefinition::Linear, 3.1536e+07},
+
+    // Fuel efficiency
+    {LitersPer100Kilometers, FuelEfficiencyCategory, UnitDefinition::Linear, 1},
+    {MilePerUsGallon, FuelEfficiencyCategory, UnitDefinition::Reciprocal, 235.215},
+    {MilePerImperialGallon, FuelEfficiencyCategory, UnitDefinition::Reciprocal, 282.481},
+    {KilometrePerLitre, FuelEfficiencyCategory, UnitDefinition::Reciprocal, 100.0},
+
+    // Density
+    {KilogramsPerCubicMeter, DensityCategory, UnitDefinition::Linear, 1},
+    {KilogramPerLiter, DensityCategory, UnitDefinition::Linear, 1000},
+    {GramPerLiter, DensityCategory, UnitDefinition::Linear, 1},
+    {GramPerMilliliter, DensityCategory, UnitDefinition::Linear, 1000},
+    {OuncePerCubicInch, DensityCategory, UnitDefinition::Linear, 1729.99404},
+    {OuncePerCubicFoot, DensityCategory, UnitDefinition::Linear, 1.00115396},
+    {PoundPerCubicInch, DensityCategory, UnitDefinition::Linear, 27679.9047},
+    {PoundPerCubicFoot, DensityCategory, UnitDefinition::Linear, 16.0184634},
+    {PoundPerCubicYard, DensityCategory, UnitDefinition::Linear, 0.593276421},
+
+    // Weight per area
+    {GramsPerSquareMeter, WeightPerAreaCategory, UnitDefinition::Linear, 1},
+    {OuncesPerSquareYard, WeightPerAreaCategory, UnitDefinition::Linear, 33.906},
+    {Momme, WeightPerAreaCategory, UnitDefinition::Linear, 4.34},
+
+    // Acceleration
+    {MetresPerSecondSquared, AccelerationCategory, UnitDefinition::Linear, 1},
+    {FeetPerSecondSquared, AccelerationCategory, UnitDefinition::Linear, 0.3048},
+    {StandardGravity, AccelerationCategory, UnitDefinition::Linear, 9.80665},
+
+    // Force
+    {Yottanewton, ForceCategory, UnitDefinition::Linear, 1e+24},
+    {Zettanewton, ForceCategory, UnitDefinition::Linear, 1e+21},
+    {Exanewton, ForceCategory, UnitDefinition::Linear, 1e+18},
+    {Petanewton, ForceCategory, UnitDefinition::Linear, 1e+15},
+    {Teranewton, ForceCategory, UnitDefinition::Linear, 1e+12},
+    {Giganewton, ForceCategory, UnitDefinition::Linear, 1e+09},
+    {Meganewton, ForceCategory, UnitDefinition::Linear, 1e+06},
+    {KilonewtonForce, ForceCategory, UnitDefinition::Linear, 1000},
+    {Hectonewton, ForceCategory, UnitDefinition::Linear, 100},
+    {Decanewton, ForceCategory, UnitDefinition::Linear, 10},
+    {Newton, ForceCategory, UnitDefinition::Linear, 1},
+    {Decinewton, ForceCategory, UnitDefinition::Linear, 0.1},
+    {Centinewton, ForceCategory, UnitDefinition::Linear, 0.01},
+    {Millinewton, ForceCategory, UnitDefinition::Linear, 0.001},
+    {Micronewton, ForceCategory, UnitDefinition::Linear, 1e-06},
+    {Nanonewton, ForceCategory, UnitDefinition::Linear, 1e-09},
+    {Piconewton, ForceCategory, UnitDefinition::Linear, 1e-12},
+    {Femtonewton, ForceCategory, UnitDefinition::Linear, 1e-15},
+    {Attonewton, ForceCategory, UnitDefinition::Linear, 1e-18},
+    {Zeptonewton, ForceCategory, UnitDefinition::Linear, 1e-21},
+    {Yoctonewton, ForceCategory, UnitDefinition::Linear, 1e-24},
+    {Dyne, ForceCategory, UnitDefinition::Linear, 0.0001},
+    {Kilopond, ForceCategory, UnitDefinition::Linear, 9.80665},
+    {PoundForce, ForceCategory, UnitDefinition::Linear, 4.448222},
+    {Poundal, ForceCategory, UnitDefinition::Linear, 0.138255},
+
+    // Angle
+    {Degree, AngleCategory, UnitDefinition::Linear, 1},
+    {Radian, AngleCategory, UnitDefinition::Linear, 360.0 / (2 * 3.14159265358979323846)},
+    {Gradian, AngleCategory, UnitDefinition::Linear, 360.0 / 400.0},
+    {ArcMinute, AngleCategory, UnitDefinition::Linear, 1.0 / 60.0},
+    {ArcSecond, AngleCategory, UnitDefinition::Linear, 1.0 / 3600.0},
+
+    // Frequency
+    {Yottahertz, FrequencyCategory, UnitDefinition::Linear, 1e+24},
+    {Zettahertz, FrequencyCategory, UnitDefinition::Linear, 1e+21},
+    {Exahertz, FrequencyCategory, UnitDefinition::Linear, 1e+18},
+    {Petahertz, FrequencyCategory, UnitDefinition::Linear, 1e+15},
+    {Terahertz, FrequencyCategory, UnitDefinition::Linear, 1e+12},
+    {Gigahertz, FrequencyCategory, UnitDefinition::Linear, 1e+09},
+    {Megahertz, FrequencyCategory, UnitDefinition::Linear, 1e+06},
+    {Kilohertz, FrequencyCategory, UnitDefinition::Linear, 1000},
+    {Hectohertz, FrequencyCategory, UnitDefinition::Linear, 100},
+    {Decahertz, FrequencyCategory, UnitDefinition::Linear, 10},
+    {Hertz, FrequencyCategory, UnitDefinition::Linear, 1},
+    {Decihertz, FrequencyCategory, UnitDefinition::Linear, 0.1},
+    {Centihertz, FrequencyCategory, UnitDefinition::Linear, 0.01},
+    {Millihertz, FrequencyCategory, UnitDefinition::Linear, 0.001},
+    {Microhertz, FrequencyCategory, UnitDefinition::Linear, 1e-06},
+    {Nanohertz, FrequencyCategory, UnitDefinition::Linear, 1e-09},
+    {Picohertz, FrequencyCategory, UnitDefinition::Linear, 1e-12},
+    {Femtohertz, FrequencyCategory, UnitDefinition::Linear, 1e-15},
+    {Attohertz, FrequencyCategory, UnitDefinition::Linear, 1e-18},
+    {Zeptohertz, FrequencyCategory, UnitDefinition::Linear, 1e-21},
+    {Yoctohertz, FrequencyCategory, UnitDefinition::Linear, 1e-24},
+    {RPM, FrequencyCategory, UnitDefinition::Linear, 1.0 / 60.0},
+
+    // Thermal conductivity
+    {WattPerMeterKelvin, ThermalConductivityCategory, UnitDefinition::Linear, 1},
+    {BtuPerFootHourFahrenheit, ThermalConductivityCategory, UnitDefinition::Linear, 0.5779},
+    {BtuPerSquareFootHourFahrenheitPerInch, ThermalConductivityCategory, UnitDefinition::Linear, 6.9348},
+
+    // Thermal flux
+    {WattPerSquareMeter, ThermalFluxCategory, UnitDefinition::Linear, 1},
+    {BtuPerHourPerSquareFoot, ThermalFluxCategory, UnitDefinition::Linear, 0.3169986},
+
+    // Thermal generation
+    {WattPerCubicMeter, ThermalGenerationCategory, UnitDefinition::Linear, 1},
+    {BtuPerHourPerCubicFoot, ThermalGenerationCategory, UnitDefinition::Linear, 0.09662},
+
+    // Voltage
+    {Yottavolts, VoltageCategory, UnitDefinition::Linear, 1e+24},
+    {Zettavolts, VoltageCategory, UnitDefinition::Linear, 1e+21},
+    {Exavolts, VoltageCategory, UnitDefinition::Linear, 1e+18},
+    {Petavolts, VoltageCategory, UnitDefinition::Linear, 1e+15},
+    {Teravolts, VoltageCategory, UnitDefinition::Linear, 1e+12},
+    {Gigavolts, VoltageCategory, UnitDefinition::Linear, 1e+09},
+    {Megavolts, VoltageCategory, UnitDefinition::Linear, 1e+06},
+    {Kilovolts, VoltageCategory, UnitDefinition::Linear, 1000},
+    {Hectovolts, VoltageCategory, UnitDefinition::Linear, 100},
+    {Decavolts, VoltageCategory, UnitDefinition::Linear, 10},
+    {Volts, VoltageCategory, UnitDefinition::Linear, 1},
+    {Decivolts, VoltageCategory, UnitDefinition::Linear, 0.1},
+    {Centivolts, VoltageCategory, UnitDefinition::Linear, 0.01},
+    {Millivolts, VoltageCategory, UnitDefinition::Linear, 0.001},
+    {Microvolts, VoltageCategory, UnitDefinition::Linear, 1e-06},
+    {Nanovolts, VoltageCategory, UnitDefinition::Linear, 1e-09},
+    {Picovolts, VoltageCategory, UnitDefinition::Linear, 1e-12},
+    {Femtovolts, VoltageCategory, UnitDefinition::Linear, 1e-15},
+    {Attovolts, VoltageCategory, UnitDefinition::Linear, 1e-18},
+    {Zeptovolts, VoltageCategory, UnitDefinition::Linear, 1e-21},
+    {Yoctovolts, VoltageCategory, UnitDefinition::Linear, 1e-24},
+    {Statvolts, VoltageCategory, UnitDefinition::Linear, 299.792458},
+
+    // Electrical current
+    {Yottaampere, ElectricalCurrentCategory, UnitDefinition::Linear, 1e+24},
+    {Zettaampere, ElectricalCurrentCategory, UnitDefinition::Linear, 1e+21},
+    {Exaampere, ElectricalCurrentCategory, UnitDefinition::Linear, 1e+18},
+    {Petaampere, ElectricalCurrentCategory, UnitDefinition::Linear, 1e+15},
+    {Teraampere, ElectricalCurrentCategory, UnitDefinition::Linear, 1e+12},
+    {Gigaampere, ElectricalCurrentCategory, UnitDefinition::Linear, 1e+09},
+    {Megaampere, ElectricalCurrentCategory, UnitDefinition::Linear, 1e+06},
+    {Kiloampere, ElectricalCurrentCategory, UnitDefinition::Linear, 1000},
+    {Hectoampere, ElectricalCurrentCategory, UnitDefinition::Linear, 100},
+    {Decaampere, ElectricalCurrentCategory, UnitDefinition::Linear, 10},
+    {Ampere, ElectricalCurrentCategory, UnitDefinition::Linear, 1},
+    {Deciampere, ElectricalCurrentCategory, UnitDefinition::Linear, 0.1},
+    {Centiampere, ElectricalCurrentCategory, UnitDefinition::Linear, 0.01},
+    {Milliampere, ElectricalCurrentCategory, UnitDefinition::Linear, 0.001},
+    {Microampere, ElectricalCurrentCategory, UnitDefinition::Linear, 1e-06},
+    {Nanoampere, ElectricalCurrentCategory, UnitDefinition::Linear, 1e-09},
+    {Picoampere, ElectricalCurrentCategory, UnitDefinition::Linear, 1e-12},
+    {Femtoampere, ElectricalCurrentCategory, UnitDefinition::Linear, 1e-15},
+    {Attoampere, ElectricalCurrentCategory, UnitDefinition::Linear, 1e-18},
+    {Zeptoampere, ElectricalCurrentCategory, UnitDefinition::Linear, 1e-21},
+    {Yoctoampere, ElectricalCurrentCategory, UnitDefinition::Linear, 1e-24},
+
+    // Electrical resistance
+    {Yottaohms, ElectricalResistanceCategory, UnitDefinition::Linear, 1e+24},
+    {Zettaohms, ElectricalResistanceCategory, UnitDefinition::Linear, 1e+21},
+    {Exaohms, ElectricalResistanceCategory, UnitDefinition::Linear, 1e+18},
+    {Petaohms, ElectricalResistanceCategory, UnitDefinition::Linear, 1e+15},
+    {Teraohms, ElectricalResistanceCategory, UnitDefinition::Linear, 1e+12},
+    {Gigaohms, ElectricalResistanceCategory, UnitDefinition::Linear, 1e+09},
+    {Megaohms, ElectricalResistanceCategory, UnitDefinition::Linear, 1e+06},
+    {Kiloohms, ElectricalResistanceCategory, UnitDefinition::Linear, 1000},
+    {Hectoohms, ElectricalResistanceCategory, UnitDefinition::Linear, 100},
+    {Decaohms, ElectricalResistanceCategory, UnitDefinition::Linear, 10},
+    {Ohms, ElectricalResistanceCategory, UnitDefinition::Linear, 1},
+    {Deciohms, ElectricalResistanceCategory, UnitDefinition::Linear, 0.1},
+    {Centiohms, ElectricalResistanceCategory, UnitDefinition::Linear, 0.01},
+    {Milliohms, ElectricalResistanceCategory, UnitDefinition::Linear, 0.001},
+    {Microohms, ElectricalResistanceCategory, UnitDefinition::Linear, 1e-06},
+    {Nanoohms, ElectricalResistanceCategory, UnitDefinition::Linear, 1e-09},
+    {Picoohms, ElectricalResistanceCategory, UnitDefinition::Linear, 1e-12},
+    {Femtoohms, ElectricalResistanceCategory, UnitDefinition::Linear, 1e-15},
+    {Attoohms, ElectricalResistanceCategory, UnitDefinition::Linear, 1e-18},
+    {Zeptoohms, ElectricalResistanceCategory, UnitDefinition::Linear, 1e-21},
+    {Yoctoohms, ElectricalResistanceCategory, UnitDefinition::Linear, 1e-24},
+
+    // Permeability
+    {Darcy, PermeabilityCategory, UnitDefinition::Linear, 1},
+    {MiliDarcy, PermeabilityCategory, UnitDefinition::Linear, 0.001},
+    {PermeabilitySquareMicrometer, PermeabilityCategory, UnitDefinition::Linear, 0.9869233},
+
+    // Binary data
+    {Yobibyte, BinaryDataCategory, UnitDefinition::Linear, 0x1p83},
+    {Yobibit, BinaryDataCategory, UnitDefinition::Linear, 0x1p80},
+    {Yottabyte, BinaryDataCategory, UnitDefinition::Linear, 8e+24},
+    {Yottabit, BinaryDataCategory, UnitDefinition::Linear, 1e+24},
+    {Zebibyte, BinaryDataCategory, UnitDefinition::Linear, 0x1p73},
+    {Zebibit, BinaryDataCategory, UnitDefinition::Linear, 0x1p70},
+    {Zettabyte, BinaryDataCategory, UnitDefinition::Linear, 8e+21},
+    {Zettabit, BinaryDataCategory, UnitDefinition::Linear, 1e+21},
+    {Exbibyte, BinaryDataCategory, UnitDefinition::Linear, 0x1p63},
+    {Exbibit, BinaryDataCategory, UnitDefinition::Linear, 0x1p60},
+    {Exabyte, BinaryDataCategory, UnitDefinition::Linear, 8e+18},
+    {Exabit, BinaryDataCategory, UnitDefinition::Linear, 1e+18},
+    {Pebibyte, BinaryDataCategory, UnitDefinition::Linear, 0x1p53},
+    {Pebibit, BinaryDataCategory, UnitDefinition::Linear, 0x1p50},
+    {Petabyte, BinaryDataCategory, UnitDefinition::Linear, 8e+15},
+    {Petabit, BinaryDataCategory, UnitDefinition::Linear, 1e+15},
+    {Tebibyte, BinaryDataCategory, UnitDefinition::Linear, 0x1p43},
+    {Tebibit, BinaryDataCategory, UnitDefinition::Linear, 0x1p40},
+    {Terabyte, BinaryDataCategory, UnitDefinition::Linear, 8e+12},
+    {Terabit, BinaryDataCategory, UnitDefinition::Linear, 1e+12},
+    {Gibibyte, BinaryDataCategory, UnitDefinition::Linear, 0x1p33},
+    {Gibibit, BinaryDataCategory, UnitDefinition::Linear, 0x1p30},
+    {Gigabyte, BinaryDataCategory, UnitDefinition::Linear, 8e+09},
+    {Gigabit, BinaryDataCategory, UnitDefinition::Linear, 1e+09},
+    {Mebibyte, BinaryDataCategory, UnitDefinition::Linear, 0x1p23},
+    {Mebibit, BinaryDataCategory, UnitDefinition::Linear, 0x1p20},
+    {Megabyte, BinaryDataCategory, UnitDefinition::Linear, 8e+06},
+    {Megabit, BinaryDataCategory, UnitDefinition::Linear, 1e+06},
+    {Kibibyte, BinaryDataCategory, UnitDefinition::Linear, 8192},
+    {Kibibit, BinaryDataCategory, UnitDefinition::Linear, 1024},
+    {Kilobyte, BinaryDataCategory, UnitDefinition::Linear, 8000},
+    {Kilobit, BinaryDataCategory, UnitDefinition::Linear, 1000},
+    {Byte, BinaryDataCategory, UnitDefinition::Linear, 8},
+    {Bit, BinaryDataCategory, UnitDefinition::Linear, 1},
+};
+
+/*!
+ * \inheaderfile KUnitConversion/UnitTable
+ *
+ * Returns the definition of \a unitId, nullptr for currencies and unknown ids.
+ *
+ * \since 6.28
+ */
+constexpr const UnitDefinition *unitDefinition(UnitId unitId)
+{
+    // std::lower_bound is only constexpr since C++20
+    std::size_t begin = 0;
+    std::size_t end = std::size(unitDefinitions);
+    while (begin < end) {
+        const std::size_t middle = begin + (end - begin) / 2;
+        if (unitDefinitions[middle].id < unitId) {
+            begin = middle + 1;
+        } else {
+            end = middle;
+        }
+    }
+    return begin != std::size(unitDefinitions) && unitDefinitions[begin].id == unitId ? &unitDefinitions[begin] : nullptr;
+}
+
+/*!
+ * \inheaderfile KUnitConversion/UnitTable
+ *
+ * Converts \a value from \a FromUnit to \a ToUnit, both known at compile time.
+ *
+ * Both units have to belong to the same category and have a Linear or
+ * Reciprocal definition unless they are the same unit, anything else fails
+ * to compile. The conversion is
+ * folded into a single constant, so e.g. convert<Kilometer, Mile>(x)
+ * compiles to one multiplication.
+ *
+ * \code
+ * static_assert(KUnitConversion::convert<KUnitConversion::Kilometer, KUnitConversion::Meter>(1.5) == 1500.0);
+ * \endcode
+ *
+ * \since 6.28
+ */
+template<UnitId FromUnit, UnitId ToUnit>
+constexpr qreal convert(qreal value)
+{
+    constexpr const UnitDefinition *from = unitDefinition(FromUnit);
+    constexpr const UnitDefinition *to = unitDefinition(ToUnit);
+    static_assert(from && to, "both units need a definition, currencies have none");
+    static_assert(from->categoryId == to->categoryId, "the units belong to different categories");
+    if constexpr (FromUnit == ToUnit) {
+        return value;
+    } else {
+        static_assert(from->kind != UnitDefinition::Other && to->kind != UnitDefinition::Other, "the units can only be converted at runtime");
+
+        // the same folding as ConversionPlan does
+        using Extended = long double;
+        if constexpr (from->kind == UnitDefinition::Linear && to->kind == UnitDefinition::Linear) {
+            constexpr qreal a = qreal(Extended(from->scale) / to->scale);
+            constexpr qreal b = qreal((Extended(from->offset) - to->offset) / to->scale);
+            if constexpr (b == 0.0) {
+                return a * value;
+            } else {
+                return a * value + b;
+            }
+        } else if constexpr (from->kind == UnitDefinition::Reciprocal && to->kind == UnitDefinition::Reciprocal) {
+            constexpr qreal a = qreal(Extended(to->scale) / from->scale);
+            return a * value;
+        } else if constexpr (from->kind == UnitDefinition::Reciprocal) {
+            static_assert(to->offset == 0.0, "reciprocal units only convert to units without offset");
+            constexpr qreal a = qreal(Extended(from->scale) / to->scale);
+            return a / value;
+        } else {
+            static_assert(from->offset == 0.0, "reciprocal units only convert to units without offset");
+            constexpr qreal a = qreal(Extended(to->scale) / from->scale);
+            return a / value;
+        }
+    }
+}
+
+} // KUnitConversion namespace
+
+#endif // KUNITCONVERSION_UNITTABLE_H
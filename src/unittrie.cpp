@@ -0,0 +1,222 @@
+/*
+ *   SPDX-FileCopyrightText: 2026 KUnitConversion Authors
+ *
+ *   SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#include "unittrie_p.h"
+
+#include <QSet>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace KUnitConversion
+{
+UnitTrie::UnitTrie(const QList<std::pair<QString, Unit>> &units)
+{
+    QSet<QString> names;
+    names.reserve(units.size());
+    m_entries.reserve(units.size());
+    for (const auto &[name, unit] : units) {
+        if (!names.contains(name)) {
+            names.insert(name);
+            m_entries.append(Entry{key(name), name, unit});
+            m_maxKeyLength = std::max(m_maxKeyLength, m_entries.last().key.size());
+        }
+    }
+    // stable, so names differing only in case keep the order they were given in
+    std::stable_sort(m_entries.begin(), m_entries.end(), [](const Entry &lhs, const Entry &rhs) {
+        return lhs.key < rhs.key;
+    });
+    if (m_entries.isEmpty()) {
+        return;
+    }
+
+    // entries are sorted, so the longest common prefix of a range is the one of its first and last key
+    const auto commonPrefixLength = [this](qsizetype begin, qsizetype end) {
+        const QString &first = m_entries[begin].key;
+        const QString &last = m_entries[end - 1].key;
+        qsizetype length = 0;
+        while (length < first.size() && length < last.size() && first[length] == last[length]) {
+            ++length;
+        }
+        return quint16(length);
+    };
+
+    // breadth first, so the children of each node end up next to each other
+    m_nodes.append(Node{0, quint32(m_entries.size()), 0, 0, commonPrefixLength(0, m_entries.size())});
+    for (qsizetype i = 0; i < m_nodes.size(); ++i) {
+        const Node node = m_nodes[i];
+        qsizetype pos = node.begin;
+        // keys ending at this node sort before the longer ones
+        while (pos < node.end && m_entries[pos].key.size() == node.depth) {
+            ++pos;
+        }
+
+        quint16 childCount = 0;
+        m_nodes[i].firstChild = m_nodes.size();
+        while (pos < node.end) {
+            const QChar c = m_entries[pos].key[node.depth];
+            qsizetype groupEnd = pos + 1;
+            while (groupEnd < node.end && m_entries[groupEnd].key[node.depth] == c) {
+                ++groupEnd;
+            }
+            m_nodes.append(Node{quint32(pos), quint32(groupEnd), 0, 0, commonPrefixLength(pos, groupEnd)});
+            ++childCount;
+            pos = groupEnd;
+        }
+        m_nodes[i].childCount = childCount;
+    }
+    m_nodes.squeeze();
+}
+
+QString UnitTrie::key(QStringView name)
+{
+    return name.toString().toCaseFolded();
+}
+
+const UnitTrie::Node *UnitTrie::find(QStringView key) const
+{
+    if (m_nodes.isEmpty()) {
+        return nullptr;
+    }
+
+    const Node *node = m_nodes.constData();
+    qsizetype depth = 0;
+    for (;;) {
+        // the label of a node is part of the key of its first entry
+        const qsizetype labelEnd = qMin<qsizetype>(node->depth, key.size());
+        if (QStringView(m_entries[node->begin].key).sliced(depth, labelEnd - depth) != key.sliced(depth, labelEnd - depth)) {
+            return nullptr;
+        }
+        if (key.size() <= node->depth) {
+            return node;
+        }
+
+        depth = node->depth;
+        const QChar c = key[depth];
+        const Node *children = m_nodes.constData() + node->firstChild;
+        const Node *childrenEnd = children + node->childCount;
+        node = std::lower_bound(children, childrenEnd, c, [this, depth](const Node &child, QChar c) {
+            return m_entries[child.begin].key[depth] < c;
+        });
+        if (node == childrenEnd || m_entries[node->begin].key[depth] != c) {
+            return nullptr;
+        }
+    }
+}
+
+std::pair<qsizetype, qsizetype> UnitTrie::matches(const Node *node, QStringView key) const
+{
+    if (!node || node->depth != key.size()) {
+        return {0, 0};
+    }
+    qsizetype end = node->begin;
+    while (end < node->end && m_entries[end].key.size() == key.size()) {
+        ++end;
+    }
+    return {node->begin, end};
+}
+
+const Unit *UnitTrie::unit(QStringView name) const
+{
+    const QString nameKey = key(name);
+    const auto [begin, end] = matches(find(nameKey), nameKey);
+    for (qsizetype i = begin; i < end; ++i) {
+        if (m_entries[i].name == name) {
+            return &m_entries[i].unit;
+        }
+    }
+    return nullptr;
+}
+
+const Unit *UnitTrie::unitIgnoringCase(QStringView name) const
+{
+    const QString nameKey = key(name);
+    const auto [begin, end] = matches(find(nameKey), nameKey);
+    for (qsizetype i = begin; i < end; ++i) {
+        if (m_entries[i].name == name) {
+            return &m_entries[i].unit;
+        }
+    }
+    return begin < end ? &m_entries[begin].unit : nullptr;
+}
+
+QStringList UnitTrie::namesStartingWith(QStringView prefix, Qt::CaseSensitivity cs, qsizetype maxCount) const
+{
+    QStringList names;
+    const Node *node = find(key(prefix));
+    if (!node || maxCount == 0) {
+        return names;
+    }
+    for (qsizetype i = node->begin; i < node->end; ++i) {
+        if (cs == Qt::CaseInsensitive || m_entries[i].name.startsWith(prefix)) {
+            names.append(m_entries[i].name);
+            if (names.size() == maxCount) {
+                break;
+            }
+        }
+    }
+    return names;
+}
+
+void UnitTrie::collectSimilar(const Node &node, qsizetype depth, int *rows, QStringView key, int maxDistance, QList<std::pair<int, qsizetype>> &matches) const
+{
+    // extend the edit distance matrix along the label of the node, giving up
+    // once no cell is within the distance as the rows never decrease
+    const qsizetype width = key.size() + 1;
+    const QString &label = m_entries[node.begin].key;
+    for (qsizetype i = depth; i < node.depth; ++i) {
+        const int *row = rows + i * width;
+        int *next = rows + (i + 1) * width;
+        next[0] = row[0] + 1;
+        int best = next[0];
+        for (qsizetype j = 1; j < width; ++j) {
+            next[j] = std::min({row[j] + 1, next[j - 1] + 1, row[j - 1] + (label[i] == key[j - 1] ? 0 : 1)});
+            best = std::min(best, next[j]);
+        }
+        if (best > maxDistance) {
+            return;
+        }
+    }
+
+    const int distance = rows[node.depth * width + key.size()];
+    if (distance <= maxDistance) {
+        for (qsizetype i = node.begin; i < node.end && m_entries[i].key.size() == node.depth; ++i) {
+            matches.append({distance, i});
+        }
+    }
+    for (quint32 child = node.firstChild; child < node.firstChild + node.childCount; ++child) {
+        collectSimilar(m_nodes[child], node.depth, rows, key, maxDistance, matches);
+    }
+}
+
+QStringList UnitTrie::similarNames(QStringView name, qsizetype maxCount, int maxDistance) const
+{
+    QStringList names;
+    if (m_nodes.isEmpty() || maxCount == 0 || maxDistance < 0) {
+        return names;
+    }
+
+    const QString nameKey = key(name);
+    const qsizetype width = nameKey.size() + 1;
+    std::vector<int> rows((m_maxKeyLength + 1) * width);
+    std::iota(rows.begin(), rows.begin() + width, 0);
+    QList<std::pair<int, qsizetype>> matches;
+    collectSimilar(m_nodes.first(), 0, rows.data(), nameKey, maxDistance, matches);
+
+    // matches are found in key order, keep that for equal distances
+    std::stable_sort(matches.begin(), matches.end(), [](const auto &lhs, const auto &rhs) {
+        return lhs.first < rhs.first;
+    });
+    const qsizetype count = maxCount < 0 ? matches.size() : std::min(maxCount, matches.size());
+    names.reserve(count);
+    for (qsizetype i = 0; i < count; ++i) {
+        names.append(m_entries[matches[i].second].name);
+    }
+    return names;
+}
+
+} // KUnitConversion namespace
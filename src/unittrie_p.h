@@ -0,0 +1,101 @@
+/*
+ *   SPDX-FileCopyrightText: 2026 KUnitConversion Authors
+ *
+ *   SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#ifndef KUNITCONVERSION_UNITTRIE_P_H
+#define KUNITCONVERSION_UNITTRIE_P_H
+
+#include "kunitconversion/kunitconversion_export.h"
+#include "unit.h"
+
+#include <QList>
+#include <QString>
+#include <QStringList>
+#include <QStringView>
+
+namespace KUnitConversion
+{
+/**
+ * Read-only compressed trie over unit names, keyed by their case folded form.
+ *
+ * Entries are kept sorted by key, so the names sharing a prefix form one
+ * contiguous range and every node only stores the bounds of its range. Node
+ * labels are not stored at all, they are read from the first key of the range.
+ */
+class KUNITCONVERSION_EXPORT UnitTrie
+{
+public:
+    /**
+     * Builds the trie from @p units, a list of unit names and their units.
+     * If a name occurs more than once the first occurrence wins.
+     */
+    explicit UnitTrie(const QList<std::pair<QString, Unit>> &units);
+
+    /** Unit named exactly @p name, nullptr if there is none. */
+    const Unit *unit(QStringView name) const;
+
+    /**
+     * Unit named @p name ignoring case, nullptr if there is none.
+     * An exact match is preferred over other spellings.
+     */
+    const Unit *unitIgnoringCase(QStringView name) const;
+
+    /**
+     * Names starting with @p prefix in case folded order, at most @p maxCount
+     * of them unless @p maxCount is negative.
+     */
+    QStringList namesStartingWith(QStringView prefix, Qt::CaseSensitivity cs, qsizetype maxCount = -1) const;
+
+    /**
+     * Names whose key is at most @p maxDistance insertions, deletions or
+     * substitutions away from the key of @p name, the closest first, at most
+     * @p maxCount of them unless @p maxCount is negative.
+     */
+    QStringList similarNames(QStringView name, qsizetype maxCount, int maxDistance) const;
+
+    /** Number of names in the trie. */
+    qsizetype size() const
+    {
+        return m_entries.size();
+    }
+
+    /** Key the trie uses for @p name. */
+    static QString key(QStringView name);
+
+private:
+    struct Entry {
+        QString key; //!< case folded name
+        QString name;
+        Unit unit;
+    };
+
+    struct Node {
+        quint32 begin; //!< first entry with the prefix of this node
+        quint32 end; //!< one past the last entry with the prefix of this node
+        quint32 firstChild; //!< children are stored contiguously, sorted by their first character
+        quint16 childCount;
+        quint16 depth; //!< length of the prefix of this node
+    };
+
+    /** Node whose prefix starts with @p key and is the shortest such, nullptr if there is none. */
+    const Node *find(QStringView key) const;
+
+    /** Entries of @p node whose key is exactly @p key. */
+    std::pair<qsizetype, qsizetype> matches(const Node *node, QStringView key) const;
+
+    /**
+     * Adds the entries below @p node within @p maxDistance of @p key to @p matches.
+     * @p rows holds a row of the edit distance matrix for every depth, valid up to @p depth.
+     */
+    void collectSimilar(const Node &node, qsizetype depth, int *rows, QStringView key, int maxDistance, QList<std::pair<int, qsizetype>> &matches) const;
+
+    QList<Entry> m_entries;
+    QList<Node> m_nodes;
+    qsizetype m_maxKeyLength = 0;
+};
+
+} // KUnitConversion namespace
+
+#endif // KUNITCONVERSION_UNITTRIE_P_H
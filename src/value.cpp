@@ -6,7 +6,8 @@
  */
 
 #include "value.h"
-#include "converter.h"
+#include "converter_p.h"
+#include "unitcategory_p.h"
 
 #include <QVariant>
 #include <qmath.h>
@@ -24,7 +25,9 @@ public:
     ValuePrivate(qreal number, UnitId unitId = InvalidUnit)
         : m_number(number)
     {
-        m_unit = m_converter.unit(unitId);
+        if (const Unit *unit = ConverterPrivate::instance()->unit(unitId)) {
+            m_unit = *unit;
+        }
     }
 
     ValuePrivate(qreal number, const Unit &unit)
@@ -36,7 +39,9 @@ public:
     ValuePrivate(qreal number, const QString &unitString)
         : m_number(number)
     {
-        m_unit = m_converter.unit(unitString);
+        if (const Unit *unit = ConverterPrivate::instance()->unit(unitString)) {
+            m_unit = *unit;
+        }
     }
 
     ValuePrivate(const ValuePrivate &other)
@@ -74,7 +79,6 @@ public:
 
     qreal m_number;
     Unit m_unit;
-    Converter m_converter;
 };
 
 Value::Value()
@@ -177,6 +181,20 @@ QString Value::toSymbolString(int fieldWidth, char format, int precision, const
     return QString();
 }
 
+void Value::appendString(QString &buffer, int fieldWidth, char format, int precision, const QChar &fillChar) const
+{
+    if (isValid()) {
+        d->m_unit.appendString(buffer, d->m_number, fieldWidth, format, precision, fillChar);
+    }
+}
+
+void Value::appendSymbolString(QString &buffer, int fieldWidth, char format, int precision, const QChar &fillChar) const
+{
+    if (isValid()) {
+        d->m_unit.appendSymbolString(buffer, d->m_number, fieldWidth, format, precision, fillChar);
+    }
+}
+
 Value &Value::round(uint decimals)
 {
     if (!isValid()) {
@@ -190,10 +208,22 @@ Value &Value::round(uint decimals)
     return *this;
 }
 
+Value Value::toBestUnit() const
+{
+    if (!isValid()) {
+        return *this;
+    }
+    const Unit unit = UnitCategoryPrivate::bestUnit(d->m_unit, d->m_number);
+    if (unit == d->m_unit) {
+        return *this;
+    }
+    return convertTo(unit);
+}
+
 Value Value::convertTo(const Unit &unit) const
 {
     if (d) {
-        return d->m_converter.convert(*this, unit);
+        return UnitCategoryPrivate::convertValue(d->m_unit, d->m_number, unit);
     }
     return Value();
 }
@@ -201,7 +231,7 @@ Value Value::convertTo(const Unit &unit) const
 Value Value::convertTo(UnitId unitId) const
 {
     if (d) {
-        return d->m_converter.convert(*this, unitId);
+        return UnitCategoryPrivate::convertValue(d->m_unit, d->m_number, unitId);
     }
     return Value();
 }
@@ -209,9 +239,17 @@ Value Value::convertTo(UnitId unitId) const
 Value Value::convertTo(const QString &unitString) const
 {
     if (d) {
-        return d->m_converter.convert(*this, unitString);
+        return UnitCategoryPrivate::convertValue(d->m_unit, d->m_number, unitString);
     }
     return Value();
 }
 
+qreal Value::numberIn(UnitId unitId) const
+{
+    if (d) {
+        return UnitCategoryPrivate::convertNumber(d->m_unit, d->m_number, unitId);
+    }
+    return qQNaN();
+}
+
 }
@@ -135,6 +135,25 @@ public:
      **/
     QString toSymbolString(int fieldWidth = 0, char format = 'g', int precision = -1, const QChar &fillChar = QLatin1Char(' ')) const;
 
+    /*!
+     * Appends the same text as toString() to \a buffer.
+     *
+     * Together with QLocale::FloatingPointShortest as \a precision this is
+     * the fastest way to write many values without losing precision.
+     *
+     * \sa Unit::appendString()
+     * \since 6.28
+     **/
+    void appendString(QString &buffer, int fieldWidth = 0, char format = 'g', int precision = -1, const QChar &fillChar = QLatin1Char(' ')) const;
+
+    /*!
+     * Appends the same text as toSymbolString() to \a buffer.
+     *
+     * \sa Unit::appendSymbolString()
+     * \since 6.28
+     **/
+    void appendSymbolString(QString &buffer, int fieldWidth = 0, char format = 'g', int precision = -1, const QChar &fillChar = QLatin1Char(' ')) const;
+
     /*!
      * Rounds value to decimal count
      *
@@ -142,6 +161,19 @@ public:
      **/
     Value &round(uint decimals);
 
+    /*!
+     * Returns the value in the largest unit of the same system in which its
+     * number is still at least 1, e.g. 1536 KiB as 1.5 MiB or 0.02 km as 20 m.
+     *
+     * Lengths, times, power and binary data sizes are scaled, binary data
+     * staying with powers of 1000 or 1024 and with bytes or bits. Values in
+     * other units, zero and invalid values are returned unchanged.
+     *
+     * \sa Converter::toBestUnits()
+     * \since 6.28
+     **/
+    Value toBestUnit() const;
+
     /*!
      * Convert to another unit
      **/
@@ -157,6 +189,17 @@ public:
      **/
     Value convertTo(const QString &unit) const;
 
+    /*!
+     * Returns the number of this value converted to \a unit, the same number
+     * as convertTo(\a unit).number(), or NaN if the value cannot be converted.
+     *
+     * No Value is created for the result, so unlike convertTo() converting
+     * from many threads does not contend on the reference count of \a unit.
+     *
+     * \since 6.28
+     **/
+    qreal numberIn(UnitId unit) const;
+
 private:
     QSharedDataPointer<ValuePrivate> d;
 };
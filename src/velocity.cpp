@@ -19,14 +19,13 @@ class BeaufortUnitPrivate : public UnitPrivate
 public:
     BeaufortUnitPrivate(CategoryId categoryId,
                         UnitId id,
-                        qreal multiplier,
                         const QString &symbol,
                         const QString &description,
                         const QString &matchString,
                         const KLocalizedString &symbolString,
                         const KLocalizedString &realString,
                         const KLocalizedString &integerString)
-        : UnitPrivate(categoryId, id, multiplier, symbol, description, matchString, symbolString, realString, integerString)
+        : UnitPrivate(categoryId, id, symbol, description, matchString, symbolString, realString, integerString)
     {
     }
 
@@ -49,7 +48,6 @@ UnitCategory Velocity::makeCategory()
 
     d->addDefaultUnit(UnitPrivate::makeUnit(VelocityCategory,
                               MeterPerSecond,
-                              1,
                               i18nc("velocity unit symbol", "m/s"),
                               i18nc("unit description in lists", "meters per second"),
                               i18nc("unit synonyms for matching user input", "meter per second;meters per second;m/s;ms"),
@@ -59,7 +57,6 @@ UnitCategory Velocity::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(VelocityCategory,
                              KilometerPerHour,
-                             0.277778,
                              i18nc("velocity unit symbol", "km/h"),
                              i18nc("unit description in lists", "kilometers per hour"),
                              i18nc("unit synonyms for matching user input", "kilometer per hour;kilometers per hour;km/h;kmh;kph"),
@@ -69,7 +66,6 @@ UnitCategory Velocity::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(VelocityCategory,
                              MilePerHour,
-                             0.44704,
                              i18nc("velocity unit symbol", "mph"),
                              i18nc("unit description in lists", "miles per hour"),
                              i18nc("unit synonyms for matching user input", "mile per hour;miles per hour;mph"),
@@ -79,7 +75,6 @@ UnitCategory Velocity::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VelocityCategory,
                        FootPerSecond,
-                       0.3048,
                        i18nc("velocity unit symbol", "ft/s"),
                        i18nc("unit description in lists", "feet per second"),
                        i18nc("unit synonyms for matching user input", "foot per second;feet per second;ft/s;ft/sec;fps"),
@@ -89,7 +84,6 @@ UnitCategory Velocity::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VelocityCategory,
                        InchPerSecond,
-                       0.0254,
                        i18nc("velocity unit symbol", "in/s"),
                        i18nc("unit description in lists", "inches per second"),
                        i18nc("unit synonyms for matching user input", "inch per second;inches per second;in/s;in/sec;ips"),
@@ -99,7 +93,6 @@ UnitCategory Velocity::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(VelocityCategory,
                              Knot,
-                             0.514444,
                              i18nc("velocity unit symbol", "kt"),
                              i18nc("unit description in lists", "knots"),
                              i18nc("unit synonyms for matching user input", "knot;knots;kt;nautical miles per hour"),
@@ -110,7 +103,6 @@ UnitCategory Velocity::makeCategory()
     // http://en.wikipedia.org/wiki/Speed_of_sound
     d->addCommonUnit(UnitPrivate::makeUnit(VelocityCategory,
                              Mach,
-                             343,
                              i18nc("velocity unit symbol", "Ma"),
                              i18nc("unit description in lists", "Mach"),
                              i18nc("unit synonyms for matching user input", "mach;machs;Ma;speed of sound"),
@@ -120,7 +112,6 @@ UnitCategory Velocity::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VelocityCategory,
                        SpeedOfLight,
-                       2.99792458e+08,
                        i18nc("velocity unit symbol", "c"),
                        i18nc("unit description in lists", "speed of light"),
                        i18nc("unit synonyms for matching user input", "speed of light;c"),
@@ -131,7 +122,6 @@ UnitCategory Velocity::makeCategory()
     // http://en.wikipedia.org/wiki/Beaufort_scale
     d->addUnit(UnitPrivate::makeUnit(new BeaufortUnitPrivate(VelocityCategory,
                                                Beaufort,
-                                               1.0,
                                                i18nc("velocity unit symbol", "bft"),
                                                i18nc("unit description in lists", "Beaufort"),
                                                i18nc("unit synonyms for matching user input", "Beaufort;Bft"),
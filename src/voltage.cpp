@@ -21,7 +21,6 @@ UnitCategory Voltage::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VoltageCategory,
                        Yottavolts,
-                       1e+24,
                        i18nc("voltage unit symbol", "YV"),
                        i18nc("unit description in lists", "yottavolts"),
                        i18nc("unit synonyms for matching user input", "yottavolt;yottavolts;YV"),
@@ -31,7 +30,6 @@ UnitCategory Voltage::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VoltageCategory,
                        Zettavolts,
-                       1e+21,
                        i18nc("voltage unit symbol", "ZV"),
                        i18nc("unit description in lists", "zettavolts"),
                        i18nc("unit synonyms for matching user input", "zettavolt;zettavolts;ZV"),
@@ -41,7 +39,6 @@ UnitCategory Voltage::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VoltageCategory,
                        Exavolts,
-                       1e+18,
                        i18nc("voltage unit symbol", "EV"),
                        i18nc("unit description in lists", "exavolts"),
                        i18nc("unit synonyms for matching user input", "exavolt;exavolts;EV"),
@@ -51,7 +48,6 @@ UnitCategory Voltage::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VoltageCategory,
                        Petavolts,
-                       1e+15,
                        i18nc("voltage unit symbol", "PV"),
                        i18nc("unit description in lists", "petavolts"),
                        i18nc("unit synonyms for matching user input", "petavolt;petavolts;PV"),
@@ -61,7 +57,6 @@ UnitCategory Voltage::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VoltageCategory,
                        Teravolts,
-                       1e+12,
                        i18nc("voltage unit symbol", "TV"),
                        i18nc("unit description in lists", "teravolts"),
                        i18nc("unit synonyms for matching user input", "teravolt;teravolts;TV"),
@@ -71,7 +66,6 @@ UnitCategory Voltage::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(VoltageCategory,
                              Gigavolts,
-                             1e+09,
                              i18nc("voltage unit symbol", "GV"),
                              i18nc("unit description in lists", "gigavolts"),
                              i18nc("unit synonyms for matching user input", "gigavolt;gigavolts;GV"),
@@ -81,7 +75,6 @@ UnitCategory Voltage::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(VoltageCategory,
                              Megavolts,
-                             1e+06,
                              i18nc("voltage unit symbol", "MV"),
                              i18nc("unit description in lists", "megavolts"),
                              i18nc("unit synonyms for matching user input", "megavolt;megavolts;MV"),
@@ -91,7 +84,6 @@ UnitCategory Voltage::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(VoltageCategory,
                              Kilovolts,
-                             1000,
                              i18nc("voltage unit symbol", "kV"),
                              i18nc("unit description in lists", "kilovolts"),
                              i18nc("unit synonyms for matching user input", "kilovolt;kilovolts;kV"),
@@ -101,7 +93,6 @@ UnitCategory Voltage::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VoltageCategory,
                        Hectovolts,
-                       100,
                        i18nc("voltage unit symbol", "hV"),
                        i18nc("unit description in lists", "hectovolts"),
                        i18nc("unit synonyms for matching user input", "hectovolt;hectovolts;hV"),
@@ -111,7 +102,6 @@ UnitCategory Voltage::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VoltageCategory,
                        Decavolts,
-                       10,
                        i18nc("voltage unit symbol", "daV"),
                        i18nc("unit description in lists", "decavolts"),
                        i18nc("unit synonyms for matching user input", "decavolt;decavolts;daV"),
@@ -121,7 +111,6 @@ UnitCategory Voltage::makeCategory()
 
     d->addDefaultUnit(UnitPrivate::makeUnit(VoltageCategory,
                               Volts,
-                              1,
                               i18nc("voltage unit symbol", "V"),
                               i18nc("unit description in lists", "volts"),
                               i18nc("unit synonyms for matching user input", "volt;volts;V"),
@@ -131,7 +120,6 @@ UnitCategory Voltage::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VoltageCategory,
                        Decivolts,
-                       0.1,
                        i18nc("voltage unit symbol", "dV"),
                        i18nc("unit description in lists", "decivolts"),
                        i18nc("unit synonyms for matching user input", "decivolt;decivolts;dV"),
@@ -141,7 +129,6 @@ UnitCategory Voltage::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VoltageCategory,
                        Centivolts,
-                       0.01,
                        i18nc("voltage unit symbol", "cV"),
                        i18nc("unit description in lists", "centivolts"),
                        i18nc("unit synonyms for matching user input", "centivolt;centivolts;cV"),
@@ -151,7 +138,6 @@ UnitCategory Voltage::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VoltageCategory,
                        Millivolts,
-                       0.001,
                        i18nc("voltage unit symbol", "mV"),
                        i18nc("unit description in lists", "millivolts"),
                        i18nc("unit synonyms for matching user input", "millivolt;millivolts;mV"),
@@ -161,7 +147,6 @@ UnitCategory Voltage::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VoltageCategory,
                        Microvolts,
-                       1e-06,
                        i18nc("voltage unit symbol", "µV"),
                        i18nc("unit description in lists", "microvolts"),
                        i18nc("unit synonyms for matching user input", "microvolt;microvolts;µV;uV"),
@@ -171,7 +156,6 @@ UnitCategory Voltage::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VoltageCategory,
                        Nanovolts,
-                       1e-09,
                        i18nc("voltage unit symbol", "nV"),
                        i18nc("unit description in lists", "nanovolts"),
                        i18nc("unit synonyms for matching user input", "nanovolt;nanovolts;nV"),
@@ -181,7 +165,6 @@ UnitCategory Voltage::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VoltageCategory,
                        Picovolts,
-                       1e-12,
                        i18nc("voltage unit symbol", "pV"),
                        i18nc("unit description in lists", "picovolts"),
                        i18nc("unit synonyms for matching user input", "picovolt;picovolts;pV"),
@@ -191,7 +174,6 @@ UnitCategory Voltage::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VoltageCategory,
                        Femtovolts,
-                       1e-15,
                        i18nc("voltage unit symbol", "fV"),
                        i18nc("unit description in lists", "femtovolts"),
                        i18nc("unit synonyms for matching user input", "femtovolt;femtovolts;fV"),
@@ -201,7 +183,6 @@ UnitCategory Voltage::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VoltageCategory,
                        Attovolts,
-                       1e-18,
                        i18nc("voltage unit symbol", "aV"),
                        i18nc("unit description in lists", "attovolts"),
                        i18nc("unit synonyms for matching user input", "attovolt;attovolts;aV"),
@@ -211,7 +192,6 @@ UnitCategory Voltage::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VoltageCategory,
                        Zeptovolts,
-                       1e-21,
                        i18nc("voltage unit symbol", "zV"),
                        i18nc("unit description in lists", "zeptovolts"),
                        i18nc("unit synonyms for matching user input", "zeptovolt;zeptovolts;zV"),
@@ -221,7 +201,6 @@ UnitCategory Voltage::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VoltageCategory,
                        Yoctovolts,
-                       1e-24,
                        i18nc("voltage unit symbol", "yV"),
                        i18nc("unit description in lists", "yoctovolts"),
                        i18nc("unit synonyms for matching user input", "yoctovolt;yoctovolts;yV"),
@@ -231,7 +210,6 @@ UnitCategory Voltage::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VoltageCategory,
                        Statvolts,
-                       299.792458,
                        i18nc("voltage unit symbol", "stV"),
                        i18nc("unit description in lists", "statvolts"),
                        i18nc("unit synonyms for matching user input", "statvolt;statvolts;stV"),
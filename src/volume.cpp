@@ -21,7 +21,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        CubicYottameter,
-                       1e+72,
                        i18nc("volume unit symbol", "Ym³"),
                        i18nc("unit description in lists", "cubic yottameters"),
                        i18nc("unit synonyms for matching user input", "cubic yottameter;cubic yottameters;Ym³;Ym/-3;Ym^3;Ym3"),
@@ -31,7 +30,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        CubicZettameter,
-                       1e+63,
                        i18nc("volume unit symbol", "Zm³"),
                        i18nc("unit description in lists", "cubic zettameters"),
                        i18nc("unit synonyms for matching user input", "cubic zettameter;cubic zettameters;Zm³;Zm/-3;Zm^3;Zm3"),
@@ -41,7 +39,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        CubicExameter,
-                       1e+54,
                        i18nc("volume unit symbol", "Em³"),
                        i18nc("unit description in lists", "cubic exameters"),
                        i18nc("unit synonyms for matching user input", "cubic exameter;cubic exameters;Em³;Em/-3;Em^3;Em3"),
@@ -51,7 +48,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        CubicPetameter,
-                       1e+45,
                        i18nc("volume unit symbol", "Pm³"),
                        i18nc("unit description in lists", "cubic petameters"),
                        i18nc("unit synonyms for matching user input", "cubic petameter;cubic petameters;Pm³;Pm/-3;Pm^3;Pm3"),
@@ -61,7 +57,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        CubicTerameter,
-                       1e+36,
                        i18nc("volume unit symbol", "Tm³"),
                        i18nc("unit description in lists", "cubic terameters"),
                        i18nc("unit synonyms for matching user input", "cubic terameter;cubic terameters;Tm³;Tm/-3;Tm^3;Tm3"),
@@ -71,7 +66,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        CubicGigameter,
-                       1e+27,
                        i18nc("volume unit symbol", "Gm³"),
                        i18nc("unit description in lists", "cubic gigameters"),
                        i18nc("unit synonyms for matching user input", "cubic gigameter;cubic gigameters;Gm³;Gm/-3;Gm^3;Gm3"),
@@ -81,7 +75,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        CubicMegameter,
-                       1e+18,
                        i18nc("volume unit symbol", "Mm³"),
                        i18nc("unit description in lists", "cubic megameters"),
                        i18nc("unit synonyms for matching user input", "cubic megameter;cubic megameters;Mm³;Mm/-3;Mm^3;Mm3"),
@@ -91,7 +84,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        CubicKilometer,
-                       1e+09,
                        i18nc("volume unit symbol", "km³"),
                        i18nc("unit description in lists", "cubic kilometers"),
                        i18nc("unit synonyms for matching user input", "cubic kilometer;cubic kilometers;km³;km/-3;km^3;km3"),
@@ -101,7 +93,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        CubicHectometer,
-                       1e+06,
                        i18nc("volume unit symbol", "hm³"),
                        i18nc("unit description in lists", "cubic hectometers"),
                        i18nc("unit synonyms for matching user input", "cubic hectometer;cubic hectometers;hm³;hm/-3;hm^3;hm3"),
@@ -111,7 +102,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        CubicDecameter,
-                       1000,
                        i18nc("volume unit symbol", "dam³"),
                        i18nc("unit description in lists", "cubic decameters"),
                        i18nc("unit synonyms for matching user input", "cubic decameter;cubic decameters;dam³;dam/-3;dam^3;dam3"),
@@ -121,7 +111,6 @@ UnitCategory Volume::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(VolumeCategory,
                              CubicMeter,
-                             1,
                              i18nc("volume unit symbol", "m³"),
                              i18nc("unit description in lists", "cubic meters"),
                              i18nc("unit synonyms for matching user input", "cubic meter;cubic meters;m³;m/-3;m^3;m3"),
@@ -131,7 +120,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        CubicDecimeter,
-                       0.001,
                        i18nc("volume unit symbol", "dm³"),
                        i18nc("unit description in lists", "cubic decimeters"),
                        i18nc("unit synonyms for matching user input", "cubic decimeter;cubic decimeters;dm³;dm/-3;dm^3;dm3"),
@@ -141,7 +129,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        CubicCentimeter,
-                       1e-06,
                        i18nc("volume unit symbol", "cm³"),
                        i18nc("unit description in lists", "cubic centimeters"),
                        i18nc("unit synonyms for matching user input", "cubic centimeter;cubic centimeters;cm³;cm/-3;cm^3;cm3"),
@@ -151,7 +138,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        CubicMillimeter,
-                       1e-09,
                        i18nc("volume unit symbol", "mm³"),
                        i18nc("unit description in lists", "cubic millimeters"),
                        i18nc("unit synonyms for matching user input", "cubic millimeter;cubic millimeters;mm³;mm/-3;mm^3;mm3"),
@@ -161,7 +147,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        CubicMicrometer,
-                       1e-18,
                        i18nc("volume unit symbol", "µm³"),
                        i18nc("unit description in lists", "cubic micrometers"),
                        i18nc("unit synonyms for matching user input", "cubic micrometer;cubic micrometers;µm³;um³;µm/-3;µm^3;µm3"),
@@ -171,7 +156,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        CubicNanometer,
-                       1e-27,
                        i18nc("volume unit symbol", "nm³"),
                        i18nc("unit description in lists", "cubic nanometers"),
                        i18nc("unit synonyms for matching user input", "cubic nanometer;cubic nanometers;nm³;nm/-3;nm^3;nm3"),
@@ -181,7 +165,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        CubicPicometer,
-                       1e-36,
                        i18nc("volume unit symbol", "pm³"),
                        i18nc("unit description in lists", "cubic picometers"),
                        i18nc("unit synonyms for matching user input", "cubic picometer;cubic picometers;pm³;pm/-3;pm^3;pm3"),
@@ -191,7 +174,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        CubicFemtometer,
-                       1e-45,
                        i18nc("volume unit symbol", "fm³"),
                        i18nc("unit description in lists", "cubic femtometers"),
                        i18nc("unit synonyms for matching user input", "cubic femtometer;cubic femtometers;fm³;fm/-3;fm^3;fm3"),
@@ -201,7 +183,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        CubicAttometer,
-                       1e-54,
                        i18nc("volume unit symbol", "am³"),
                        i18nc("unit description in lists", "cubic attometers"),
                        i18nc("unit synonyms for matching user input", "cubic attometer;cubic attometers;am³;am/-3;am^3;am3"),
@@ -211,7 +192,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        CubicZeptometer,
-                       1e-63,
                        i18nc("volume unit symbol", "zm³"),
                        i18nc("unit description in lists", "cubic zeptometers"),
                        i18nc("unit synonyms for matching user input", "cubic zeptometer;cubic zeptometers;zm³;zm/-3;zm^3;zm3"),
@@ -221,7 +201,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        CubicYoctometer,
-                       1e-72,
                        i18nc("volume unit symbol", "ym³"),
                        i18nc("unit description in lists", "cubic yoctometers"),
                        i18nc("unit synonyms for matching user input", "cubic yoctometer;cubic yoctometers;ym³;ym/-3;ym^3;ym3"),
@@ -231,7 +210,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        Yottaliter,
-                       1e+21,
                        i18nc("volume unit symbol", "Yl"),
                        i18nc("unit description in lists", "yottaliters"),
                        i18nc("unit synonyms for matching user input", "yottaliter;yottaliters;Yl"),
@@ -241,7 +219,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        Zettaliter,
-                       1e+18,
                        i18nc("volume unit symbol", "Zl"),
                        i18nc("unit description in lists", "zettaliters"),
                        i18nc("unit synonyms for matching user input", "zettaliter;zettaliters;Zl"),
@@ -251,7 +228,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        Exaliter,
-                       1e+15,
                        i18nc("volume unit symbol", "El"),
                        i18nc("unit description in lists", "exaliters"),
                        i18nc("unit synonyms for matching user input", "exaliter;exaliters;El"),
@@ -261,7 +237,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        Petaliter,
-                       1e+12,
                        i18nc("volume unit symbol", "Pl"),
                        i18nc("unit description in lists", "petaliters"),
                        i18nc("unit synonyms for matching user input", "petaliter;petaliters;Pl"),
@@ -271,7 +246,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        Teraliter,
-                       1e+09,
                        i18nc("volume unit symbol", "Tl"),
                        i18nc("unit description in lists", "teraliters"),
                        i18nc("unit synonyms for matching user input", "teraliter;teraliters;Tl"),
@@ -281,7 +255,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        Gigaliter,
-                       1e+06,
                        i18nc("volume unit symbol", "Gl"),
                        i18nc("unit description in lists", "gigaliters"),
                        i18nc("unit synonyms for matching user input", "gigaliter;gigaliters;Gl"),
@@ -291,7 +264,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        Megaliter,
-                       1000,
                        i18nc("volume unit symbol", "Ml"),
                        i18nc("unit description in lists", "megaliters"),
                        i18nc("unit synonyms for matching user input", "megaliter;megaliters;Ml"),
@@ -301,7 +273,6 @@ UnitCategory Volume::makeCategory()
 
     d->addDefaultUnit(UnitPrivate::makeUnit(VolumeCategory,
                               Kiloliter,
-                              1,
                               i18nc("volume unit symbol", "kl"),
                               i18nc("unit description in lists", "kiloliters"),
                               i18nc("unit synonyms for matching user input", "kiloliter;kiloliters;kl"),
@@ -311,7 +282,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        Hectoliter,
-                       0.1,
                        i18nc("volume unit symbol", "hl"),
                        i18nc("unit description in lists", "hectoliters"),
                        i18nc("unit synonyms for matching user input", "hectoliter;hectoliters;hl"),
@@ -321,7 +291,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        Decaliter,
-                       0.01,
                        i18nc("volume unit symbol", "dal"),
                        i18nc("unit description in lists", "decaliters"),
                        i18nc("unit synonyms for matching user input", "decaliter;decaliters;dal"),
@@ -331,7 +300,6 @@ UnitCategory Volume::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(VolumeCategory,
                              Liter,
-                             0.001,
                              i18nc("volume unit symbol", "l"),
                              i18nc("unit description in lists", "liters"),
                              i18nc("unit synonyms for matching user input", "liter;liters;l"),
@@ -341,7 +309,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        Deciliter,
-                       0.0001,
                        i18nc("volume unit symbol", "dl"),
                        i18nc("unit description in lists", "deciliters"),
                        i18nc("unit synonyms for matching user input", "deciliter;deciliters;dl"),
@@ -351,7 +318,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        Centiliter,
-                       1e-05,
                        i18nc("volume unit symbol", "cl"),
                        i18nc("unit description in lists", "centiliters"),
                        i18nc("unit synonyms for matching user input", "centiliter;centiliters;cl"),
@@ -361,7 +327,6 @@ UnitCategory Volume::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(VolumeCategory,
                              Milliliter,
-                             1e-06,
                              i18nc("volume unit symbol", "ml"),
                              i18nc("unit description in lists", "milliliters"),
                              i18nc("unit synonyms for matching user input", "milliliter;milliliters;ml"),
@@ -371,7 +336,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        Microliter,
-                       1e-09,
                        i18nc("volume unit symbol", "µl"),
                        i18nc("unit description in lists", "microliters"),
                        i18nc("unit synonyms for matching user input", "microliter;microliters;µl;ul"),
@@ -381,7 +345,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        Nanoliter,
-                       1e-12,
                        i18nc("volume unit symbol", "nl"),
                        i18nc("unit description in lists", "nanoliters"),
                        i18nc("unit synonyms for matching user input", "nanoliter;nanoliters;nl"),
@@ -391,7 +354,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        Picoliter,
-                       1e-15,
                        i18nc("volume unit symbol", "pl"),
                        i18nc("unit description in lists", "picoliters"),
                        i18nc("unit synonyms for matching user input", "picoliter;picoliters;pl"),
@@ -401,7 +363,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        Femtoliter,
-                       1e-18,
                        i18nc("volume unit symbol", "fl"),
                        i18nc("unit description in lists", "femtoliters"),
                        i18nc("unit synonyms for matching user input", "femtoliter;femtoliters;fl"),
@@ -411,7 +372,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        Attoliter,
-                       1e-21,
                        i18nc("volume unit symbol", "al"),
                        i18nc("unit description in lists", "attoliters"),
                        i18nc("unit synonyms for matching user input", "attoliter;attoliters;al"),
@@ -421,7 +381,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        Zeptoliter,
-                       1e-24,
                        i18nc("volume unit symbol", "zl"),
                        i18nc("unit description in lists", "zeptoliters"),
                        i18nc("unit synonyms for matching user input", "zeptoliter;zeptoliters;zl"),
@@ -431,7 +390,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        Yoctoliter,
-                       1e-27,
                        i18nc("volume unit symbol", "yl"),
                        i18nc("unit description in lists", "yoctoliters"),
                        i18nc("unit synonyms for matching user input", "yoctoliter;yoctoliters;yl"),
@@ -441,7 +399,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        CubicFoot,
-                       0.0283168,
                        i18nc("volume unit symbol", "ft³"),
                        i18nc("unit description in lists", "cubic feet"),
                        i18nc("unit synonyms for matching user input", "cubic foot;cubic feet;ft³;cubic ft;cu foot;cu ft;cu feet;feet³"),
@@ -451,7 +408,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        CubicInch,
-                       1.63871e-05,
                        i18nc("volume unit symbol", "in³"),
                        i18nc("unit description in lists", "cubic inches"),
                        i18nc("unit synonyms for matching user input", "cubic inch;cubic inches;in³;cubic inch;cubic in;cu inches;cu inch;cu in;inch³"),
@@ -461,7 +417,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        CubicMile,
-                       4.16818e+09,
                        i18nc("volume unit symbol", "mi³"),
                        i18nc("unit description in lists", "cubic miles"),
                        i18nc("unit synonyms for matching user input", "cubic mile;cubic miles;mi³;cubic mile;cubic mi;cu miles;cu mile;cu mi;mile³"),
@@ -471,7 +426,6 @@ UnitCategory Volume::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(VolumeCategory,
                              FluidOunce,
-                             2.95735e-05,
                              i18nc("volume unit symbol", "fl.oz."),
                              i18nc("unit description in lists", "fluid ounces"),
                              i18nc("unit synonyms for matching user input", "fluid ounce;fluid ounces;fl.oz.;oz.fl.;oz. fl.;fl. oz.;fl oz;fluid ounce"),
@@ -481,7 +435,6 @@ UnitCategory Volume::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(VolumeCategory,
                              Cup,
-                             0.000236588,
                              i18nc("volume unit symbol", "cp"),
                              i18nc("unit description in lists", "cups"),
                              i18nc("unit synonyms for matching user input", "cup;cups;cp"),
@@ -490,8 +443,7 @@ UnitCategory Volume::makeCategory()
                              ki18ncp("amount in units (integer)", "%1 cup", "%1 cups")));
 
     d->addCommonUnit(UnitPrivate::makeUnit(VolumeCategory,
-                                           Teaspoon,
-                                           0.000005, // FDA standard 5ml
+                                           Teaspoon, // FDA standard 5ml
                                            i18nc("volume unit symbol", "tsp"),
                                            i18nc("unit description in lists", "teaspoon"),
                                            i18nc("unit synonyms for matching user input", "teaspoon;teaspoons;tsp;tsps"),
@@ -500,8 +452,7 @@ UnitCategory Volume::makeCategory()
                                            ki18ncp("amount in units (integer)", "%1 teaspoon", "%1 teaspoons")));
 
     d->addCommonUnit(UnitPrivate::makeUnit(VolumeCategory,
-                                           Tablespoon,
-                                           0.000015, // FDA standard 15ml
+                                           Tablespoon, // FDA standard 15ml
                                            i18nc("volume unit symbol", "tbsp"),
                                            i18nc("unit description in lists", "tablespoon"),
                                            i18nc("unit synonyms for matching user input", "tablespoon;tablespoons;tbsp;tbsps"),
@@ -511,7 +462,6 @@ UnitCategory Volume::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(VolumeCategory,
                              GallonUS,
-                             0.00378541,
                              i18nc("volume unit symbol", "gal"),
                              i18nc("unit description in lists", "gallons (U.S. liquid)"),
                              i18nc("unit synonyms for matching user input", "gallon (U.S. liquid);gallons (U.S. liquid);gal;gallon;gallons"),
@@ -521,7 +471,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        GallonImperial,
-                       0.00454609,
                        i18nc("volume unit symbol", "imp gal"),
                        i18nc("unit description in lists", "gallons (imperial)"),
                        i18nc("unit synonyms for matching user input",
@@ -532,7 +481,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                              PintImperial,
-                             0.000568261,
                              i18nc("volume unit symbol", "imperial pt"),
                              i18nc("unit description in lists", "pints (imperial)"),
                              i18nc("unit synonyms for matching user input", "pint (imperial);pints (imperial);imperial pt;imperial pint;imperial pints;imperial p"),
@@ -542,7 +490,6 @@ UnitCategory Volume::makeCategory()
 
     d->addCommonUnit(UnitPrivate::makeUnit(VolumeCategory,
                        PintUS,
-                       0.000473176,
                        i18nc("volume unit symbol", "pt"),
                        i18nc("unit description in lists", "pints (U.S. liquid)"),
                        i18nc("unit synonyms for matching user input", "pint (U.S. liquid);pints (U.S. liquid);pt;pint;pints;p"),
@@ -552,7 +499,6 @@ UnitCategory Volume::makeCategory()
 
     d->addUnit(UnitPrivate::makeUnit(VolumeCategory,
                        OilBarrel,
-                       0.158987294,
                        i18nc("volume unit symbol", "bbl"),
                        i18nc("unit description in lists", "oil barrels"),
                        i18nc("unit synonyms for matching user input", "oil barrels;oil barrel;bbl"),
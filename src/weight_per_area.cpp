@@ -20,20 +20,18 @@ UnitCategory WeightPerArea::makeCategory()
     auto d = UnitCategoryPrivate::get(c);
     KLocalizedString symbolString = ki18nc("%1 value, %2 unit symbol (weight per area)", "%1 %2");
 
-    d->addCommonUnit(UnitPrivate::makeUnit(AreaCategory,
-                                     GramsPerSquareMeter,
-                                     1,
-                                     i18nc("area unit symbol", "g/m²"),
-                                     i18nc("unit description in lists", "grams per square meter"),
-                                     i18nc("unit synonyms for matching user input", "gsm;g/m;g/m2;gm2;grams per meter;grams per square meter;grams per meter²"),
-                                     symbolString,
-                                     ki18nc("amount in units (real)", "%1 grams per square meter"),
-                                     ki18ncp("amount in units (integer)", "%1 grams per square meter", "%1 grams per square meter")));
+    d->addCommonUnit(UnitPrivate::makeUnit(WeightPerAreaCategory,
+                                           GramsPerSquareMeter,
+                                           i18nc("area unit symbol", "g/m²"),
+                                           i18nc("unit description in lists", "grams per square meter"),
+                                           i18nc("unit synonyms for matching user input", "gsm;g/m;g/m2;gm2;grams per meter;grams per square meter;grams per meter²"),
+                                           symbolString,
+                                           ki18nc("amount in units (real)", "%1 grams per square meter"),
+                                           ki18ncp("amount in units (integer)", "%1 grams per square meter", "%1 grams per square meter")));
 
     // source: https://www.ginifab.com/feeds/ozyd2_gm2/
-    d->addCommonUnit(UnitPrivate::makeUnit(AreaCategory,
+    d->addCommonUnit(UnitPrivate::makeUnit(WeightPerAreaCategory,
                                            OuncesPerSquareYard,
-                                           33.906,
                                            i18nc("area unit symbol", "oz/yd²"),
                                            i18nc("unit description in lists", "ounces per square yard"),
                                            i18nc("unit synonyms for matching user input", "ozyd;ozyd2;oz/yd;oz/yd2;ounces per yard;ounces per square yard;ounces per yard²"),
@@ -42,9 +40,8 @@ UnitCategory WeightPerArea::makeCategory()
                                            ki18ncp("amount in units (integer)", "%1 ounces per square yard", "%1 ounces per square yard")));
 
     // source: https://mayfairsilk.com/pages/what-is-momme
-    d->addUnit(UnitPrivate::makeUnit(AreaCategory,
+    d->addUnit(UnitPrivate::makeUnit(WeightPerAreaCategory,
                                      Momme,
-                                     4.34,
                                      i18nc("area unit symbol for silk fabric weight", "momme"),
                                      i18nc("unit description for silk fabric weight in lists", "momme"),
                                      i18nc("unit synonyms for silk fabric weight or matching user input", "momme"),
@@ -0,0 +1,128 @@
+/*
+ *   SPDX-FileCopyrightText: 2026 KUnitConversion Authors
+ *
+ *   SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QFile>
+#include <QTextStream>
+
+#include <KLocalizedString>
+
+#include <KUnitConversion/ColumnConverter>
+#include <KUnitConversion/Converter>
+
+#include <cstdio>
+
+using namespace KUnitConversion;
+
+static int fail(const QString &message)
+{
+    QTextStream(stderr) << message << '\n';
+    return 1;
+}
+
+static bool openFile(QFile &file, const QString &fileName, QIODevice::OpenMode mode, FILE *standardStream)
+{
+    if (fileName.isEmpty() || fileName == QLatin1String("-")) {
+        return file.open(standardStream, mode);
+    }
+    file.setFileName(fileName);
+    return file.open(mode);
+}
+
+int main(int argc, char **argv)
+{
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName(QStringLiteral("kunitconvertcolumn"));
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(i18n("Converts a numeric column of a CSV or TSV file between units."));
+    parser.addHelpOption();
+
+    const QCommandLineOption fromOption(QStringLiteral("from"), i18n("Unit of the column in the input, e.g. mi."), i18nc("@info:shell value name", "unit"));
+    const QCommandLineOption toOption(QStringLiteral("to"), i18n("Unit to convert the column to, e.g. km."), i18nc("@info:shell value name", "unit"));
+    const QCommandLineOption columnOption(QStringLiteral("column"),
+                                          i18n("Zero-based index of the column to convert."),
+                                          i18nc("@info:shell value name", "index"),
+                                          QStringLiteral("0"));
+    const QCommandLineOption delimiterOption(QStringLiteral("delimiter"),
+                                             i18n("Field delimiter, a single character or \"tab\"."),
+                                             i18nc("@info:shell value name", "character"),
+                                             QStringLiteral(","));
+    const QCommandLineOption headerOption(QStringLiteral("header"),
+                                          i18n("Number of header lines copied unchanged."),
+                                          i18nc("@info:shell value name", "count"),
+                                          QStringLiteral("0"));
+    const QCommandLineOption precisionOption(QStringLiteral("precision"),
+                                             i18n("Digits after the decimal point, -1 for the shortest exact form."),
+                                             i18nc("@info:shell value name", "digits"),
+                                             QStringLiteral("-1"));
+    parser.addOption(fromOption);
+    parser.addOption(toOption);
+    parser.addOption(columnOption);
+    parser.addOption(delimiterOption);
+    parser.addOption(headerOption);
+    parser.addOption(precisionOption);
+    parser.addPositionalArgument(QStringLiteral("input"), i18n("Input file, standard input if omitted or -."), QStringLiteral("[input]"));
+    parser.addPositionalArgument(QStringLiteral("output"), i18n("Output file, standard output if omitted or -."), QStringLiteral("[output]"));
+    parser.process(app);
+
+    Converter converter;
+    const Unit fromUnit = converter.unit(parser.value(fromOption));
+    const Unit toUnit = converter.unit(parser.value(toOption));
+    if (!fromUnit.isValid() || !toUnit.isValid()) {
+        return fail(i18n("Unknown unit given with --from or --to."));
+    }
+    const ConversionPlan plan(fromUnit, toUnit);
+    if (!plan.isValid()) {
+        return fail(i18n("Cannot convert from %1 to %2.", fromUnit.symbol(), toUnit.symbol()));
+    }
+
+    bool ok = false;
+    const int column = parser.value(columnOption).toInt(&ok);
+    if (!ok || column < 0) {
+        return fail(i18n("Invalid column index."));
+    }
+    const QString delimiter = parser.value(delimiterOption);
+    if (delimiter != QLatin1String("tab") && (delimiter.size() != 1 || delimiter.at(0).unicode() > 0x7f)) {
+        return fail(i18n("The delimiter must be a single ASCII character or \"tab\"."));
+    }
+
+    ColumnConverter columnConverter(plan, column);
+    columnConverter.setDelimiter(delimiter == QLatin1String("tab") ? '\t' : delimiter.at(0).toLatin1());
+    const int headerLineCount = parser.value(headerOption).toInt(&ok);
+    if (!ok || headerLineCount < 0) {
+        return fail(i18n("Invalid number of header lines."));
+    }
+    columnConverter.setHeaderLineCount(headerLineCount);
+    const int precision = parser.value(precisionOption).toInt(&ok);
+    if (!ok || precision < -1) {
+        return fail(i18n("Invalid precision."));
+    }
+    columnConverter.setPrecision(precision);
+
+    const QStringList files = parser.positionalArguments();
+    QFile input;
+    if (!openFile(input, files.value(0), QIODevice::ReadOnly, stdin)) {
+        return fail(i18n("Cannot open input: %1", input.errorString()));
+    }
+    QFile output;
+    if (!openFile(output, files.value(1), QIODevice::WriteOnly, stdout)) {
+        return fail(i18n("Cannot open output: %1", output.errorString()));
+    }
+
+    if (!columnConverter.convert(&input, &output) || !output.flush()) {
+        return fail(i18n("Conversion failed."));
+    }
+    if (columnConverter.skippedCount() > 0) {
+        QTextStream(stderr) << i18np("%1 line without a number in column %2 was copied unchanged.",
+                                     "%1 lines without a number in column %2 were copied unchanged.",
+                                     columnConverter.skippedCount(),
+                                     column)
+                            << '\n';
+    }
+    return 0;
+}